@@ -1,2 +1,47 @@
+#include "ProjectAtomVR.h"
 
-#include "ProjectAtomVR.h"
\ No newline at end of file
+namespace
+{
+	void SerializeHandTransform(FArchive& Ar, FMotionTransformRep& Hand, const FVector& HeadLocation, bool& bOutSuccess)
+	{
+		// Hands stay within arms reach of the head, so the delta fits in far fewer bits than the full location.
+		FVector HeadDelta = Hand.Location - HeadLocation;
+		bOutSuccess &= SerializePackedVector<10, 14>(HeadDelta, Ar);
+		Hand.Rotation.SerializeCompressedShort(Ar);
+
+		if (Ar.IsLoading())
+		{
+			Hand.Location = HeadLocation + HeadDelta;
+		}
+	}
+}
+
+bool FMotionPoseRep::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	Ar << Sequence;
+	Ar << TimeStamp;
+
+	uint8 TrackedFlags = (bIsLeftHandTracked ? 1 : 0) | (bIsRightHandTracked ? 2 : 0);
+	Ar.SerializeBits(&TrackedFlags, 2);
+	bIsLeftHandTracked = (TrackedFlags & 1) != 0;
+	bIsRightHandTracked = (TrackedFlags & 2) != 0;
+
+	bool bHeadSuccess = true;
+	Head.Location.NetSerialize(Ar, Map, bHeadSuccess);
+	bOutSuccess &= bHeadSuccess;
+	Head.Rotation.SerializeCompressedShort(Ar);
+
+	if (bIsLeftHandTracked)
+	{
+		SerializeHandTransform(Ar, LeftHand, Head.Location, bOutSuccess);
+	}
+
+	if (bIsRightHandTracked)
+	{
+		SerializeHandTransform(Ar, RightHand, Head.Location, bOutSuccess);
+	}
+
+	return true;
+}
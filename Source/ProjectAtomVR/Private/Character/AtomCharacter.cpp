@@ -6,6 +6,7 @@
 #include "AtomCharacterMovementType.h"
 #include "AtomCharacterMovementComponent.h"
 #include "NetMotionControllerComponent.h"
+#include "NetMotionPoseComponent.h"
 #include "HMDCapsuleComponent.h"
 #include "HMDCameraComponent.h"
 #include "AtomLoadout.h"
@@ -21,9 +22,13 @@
 #include "AtomGameState.h"
 #include "AtomTeamInfo.h"
 #include "AtomGameMode.h"
+#include "AtomLagCompensationComponent.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogHero, Log, All);
 
+DECLARE_CYCLE_STAT(TEXT("Character Tick"), STAT_AtomCharacterTick, STATGROUP_ProjectAtom);
+DECLARE_CYCLE_STAT(TEXT("Character UpdateMeshLocation"), STAT_AtomCharacterUpdateMeshLocation, STATGROUP_ProjectAtom);
+
 namespace
 {
 	constexpr float HeadOrientationFactor = 0.35f; // Influence that the head orientation has on the body mesh
@@ -60,6 +65,8 @@ AAtomCharacter::AAtomCharacter(const FObjectInitializer& ObjectInitializer /*= F
 	Camera->SetIsReplicated(true);
 	Camera->OnPostNetTransformUpdate.BindUObject(this, &AAtomCharacter::UpdateMeshLocation);
 
+	MotionPose = CreateDefaultSubobject<UNetMotionPoseComponent>(TEXT("MotionPose"));
+
 	BodyMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("BodyMesh"));
 	BodyMesh->SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
 	BodyMesh->SetOnlyOwnerSee(true);
@@ -119,6 +126,8 @@ AAtomCharacter::AAtomCharacter(const FObjectInitializer& ObjectInitializer /*= F
 	// Setup loadout
 	Loadout = CreateDefaultSubobject<UAtomLoadout>(TEXT("Loadout"));
 
+	LagCompensation = CreateDefaultSubobject<UAtomLagCompensationComponent>(TEXT("LagCompensation"));
+
 	JumpMaxCount = 0;	
 }
 
@@ -149,18 +158,27 @@ void AAtomCharacter::BeginPlay()
 
 void AAtomCharacter::Tick( float DeltaTime )
 {
+	SCOPE_CYCLE_COUNTER(STAT_AtomCharacterTick);
+
 	Super::Tick( DeltaTime );
 
-	// Only update locally controlled mesh locations. For remotes and the server, this is updated when the camera
-	// receives a transform update through replication, with the adjusted delta time.
-	if (IsLocallyControlled())
+	// Update locally controlled and interpolated simulated mesh locations every frame. For the server and uninterpolated
+	// remotes, this is updated when the camera receives a transform update through replication, with the adjusted delta time.
+	if (IsLocallyControlled() || Camera->IsInterpolatingNetTransform())
 	{
 		UpdateMeshLocation(DeltaTime);
 	}	
+
+	if (IsLocallyControlled())
+	{
+		Loadout->UpdateHandStorageOverlaps();
+	}
 }
 
 void AAtomCharacter::UpdateMeshLocation(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_AtomCharacterUpdateMeshLocation);
+
 	if (bIsDying)
 		return;
 
@@ -324,7 +342,7 @@ bool AAtomCharacter::ReplicateSubobjects(UActorChannel *Channel, FOutBunch *Bunc
 
 void AAtomCharacter::Destroyed()
 {
-	Loadout->DestroyLoadout();
+	Loadout->ReleaseLoadout();
 
 	if (RightHandEquippable)
 	{
@@ -410,6 +428,9 @@ void AAtomCharacter::Die(AController* Killer)
 		RightHandEquippable->Drop();
 	}
 
+	// Reclaim stored items now so they are ready to be reused by the respawned loadout
+	Loadout->ReleaseLoadout();
+
 	OnDeath();
 }
 
@@ -739,6 +760,35 @@ void AAtomCharacter::NotifyTeamChanged()
 	}
 }
 
+void AAtomCharacter::ResetForRound(const FVector& Location, const FRotator& Rotation)
+{
+	check(HasAuthority() && !bIsDying);
+
+	Health = GetDefault<AAtomCharacter>(GetClass())->Health;
+
+	if (LeftHandEquippable != nullptr)
+	{
+		LeftHandEquippable->Drop();
+	}
+
+	if (RightHandEquippable != nullptr)
+	{
+		RightHandEquippable->Drop();
+	}
+
+	Loadout->ResetLoadout();
+
+	GetCharacterMovement()->StopMovementImmediately();
+	TeleportTo(Location, Rotation, false, true);
+
+	if (Controller)
+	{
+		Controller->ClientSetRotation(GetActorRotation(), true);
+	}
+
+	NotifyTeamChanged();
+}
+
 template <EHand Hand>
 void AAtomCharacter::OnEquipPressed()
 {
@@ -0,0 +1,238 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#include "ProjectAtomVR.h"
+#include "AtomLagCompensationComponent.h"
+
+#include "PhysicsEngine/BodyInstance.h"
+#include "HMDCameraComponent.h"
+#include "NetMotionControllerComponent.h"
+#include "AtomFirearm.h"
+
+namespace
+{
+	// Server frame rate used to size the history when the engine tick rate is not capped
+	constexpr float DefaultHistoryFrameRate = 90.f;
+}
+
+DECLARE_CYCLE_STAT(TEXT("LagCompensation Record"), STAT_LagCompensationRecord, STATGROUP_ProjectAtom);
+DECLARE_CYCLE_STAT(TEXT("LagCompensation Rewind"), STAT_LagCompensationRewind, STATGROUP_ProjectAtom);
+DECLARE_CYCLE_STAT(TEXT("LagCompensation Restore"), STAT_LagCompensationRestore, STATGROUP_ProjectAtom);
+
+UAtomLagCompensationComponent::UAtomLagCompensationComponent(const FObjectInitializer& ObjectInitializer /*= FObjectInitializer::Get()*/)
+	: Super(ObjectInitializer)
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = ETickingGroup::TG_PostPhysics;
+
+	bIsRewound = false;
+}
+
+void UAtomLagCompensationComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Only remote shots are rewound, so only network servers need history
+	const ENetMode NetMode = GetNetMode();
+	if (GetOwnerRole() == ROLE_Authority && (NetMode == NM_DedicatedServer || NetMode == NM_ListenServer))
+	{
+		// Remote clients display the owner's tracked devices InterpolationDelay seconds late
+		if (AAtomCharacter* const Character = Cast<AAtomCharacter>(GetOwner()))
+		{
+			InterpolationDelay = FMath::Max3(Character->GetCamera()->GetInterpolationDelay(),
+				Character->GetHandController(EHand::Left)->GetInterpolationDelay(),
+				Character->GetHandController(EHand::Right)->GetInterpolationDelay());
+		}
+
+		// A shot can be held in a client batch for up to the batch interval before it is sent
+		MaxRewindTime = MaxCompensatedPing * 0.001f + InterpolationDelay + AAtomFirearm::GetShotBatchInterval();
+
+		const float MaxTickRate = GEngine->GetMaxTickRate(0.f, false);
+		const float FrameRate = (MaxTickRate > 0.f) ? MaxTickRate : DefaultHistoryFrameRate;
+
+		History.SetNum(FMath::Max(FMath::CeilToInt(MaxRewindTime * FrameRate) + 1, 2));
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UAtomLagCompensationComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (GetOwner()->bTearOff)
+	{
+		// Torn off owners are ragdolls and are no longer rewound
+		ClearHistory();
+		SetComponentTickEnabled(false);
+		return;
+	}
+
+	RecordFrame();
+}
+
+void UAtomLagCompensationComponent::RecordFrame()
+{
+	SCOPE_CYCLE_COUNTER(STAT_LagCompensationRecord);
+
+	GatherTrackedBodies(TrackedBodies);
+
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
+
+	// Grow the history instead of overwriting a frame that can still be rewound to, i.e. the server ticks faster than estimated
+	if (HistoryNum == History.Num() && History[HistoryHead].Timestamp > CurrentTime - MaxRewindTime)
+	{
+		History.Insert(FHistoryFrame{}, HistoryHead);
+	}
+
+	FHistoryFrame& Frame = History[HistoryHead];
+	Frame.Timestamp = CurrentTime;
+	Frame.BodyTransforms.Reset(TrackedBodies.Num());
+
+	for (const FBodyInstance* Body : TrackedBodies)
+	{
+		Frame.BodyTransforms.Add(Body->GetUnrealWorldTransform());
+	}
+
+	HistoryHead = (HistoryHead + 1) % History.Num();
+	HistoryNum = FMath::Min(HistoryNum + 1, History.Num());
+}
+
+bool UAtomLagCompensationComponent::RewindTo(float WorldTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LagCompensationRewind);
+	check(!bIsRewound);
+
+	if (HistoryNum == 0 || GetOwner()->bTearOff)
+		return false;
+
+	GatherTrackedBodies(TrackedBodies);
+
+	// Walk back from the newest frame to find the frames surrounding WorldTime
+	const int32 HistoryMax = History.Num();
+	const FHistoryFrame* Newer = &History[(HistoryHead - 1 + HistoryMax) % HistoryMax];
+	const FHistoryFrame* Older = Newer;
+
+	for (int32 i = 1; i < HistoryNum && Older->Timestamp > WorldTime; ++i)
+	{
+		Newer = Older;
+		Older = &History[(HistoryHead - 1 - i + HistoryMax) % HistoryMax];
+	}
+
+	// Body layout changed since recording (i.e. physics state recreated), nothing reliable to rewind to.
+	if (Older->BodyTransforms.Num() != TrackedBodies.Num() || Newer->BodyTransforms.Num() != TrackedBodies.Num())
+		return false;
+
+	const float FrameDelta = Newer->Timestamp - Older->Timestamp;
+	const float Alpha = (FrameDelta > KINDA_SMALL_NUMBER) ? FMath::Clamp((WorldTime - Older->Timestamp) / FrameDelta, 0.f, 1.f) : 1.f;
+
+	RestoreTransforms.Reset(TrackedBodies.Num());
+
+	for (int32 i = 0; i < TrackedBodies.Num(); ++i)
+	{
+		FBodyInstance* const Body = TrackedBodies[i];
+		RestoreTransforms.Add(Body->GetUnrealWorldTransform());
+
+		FTransform RewindTransform;
+		RewindTransform.Blend(Older->BodyTransforms[i], Newer->BodyTransforms[i], Alpha);
+		Body->SetBodyTransform(RewindTransform, ETeleportType::TeleportPhysics);
+	}
+
+	bIsRewound = true;
+	return true;
+}
+
+void UAtomLagCompensationComponent::Restore()
+{
+	SCOPE_CYCLE_COUNTER(STAT_LagCompensationRestore);
+
+	if (!bIsRewound)
+		return;
+
+	check(RestoreTransforms.Num() == TrackedBodies.Num());
+
+	for (int32 i = 0; i < TrackedBodies.Num(); ++i)
+	{
+		TrackedBodies[i]->SetBodyTransform(RestoreTransforms[i], ETeleportType::TeleportPhysics);
+	}
+
+	bIsRewound = false;
+}
+
+void UAtomLagCompensationComponent::ClearHistory()
+{
+	HistoryHead = 0;
+	HistoryNum = 0;
+}
+
+void UAtomLagCompensationComponent::GatherTrackedBodies(TArray<FBodyInstance*>& OutBodies) const
+{
+	OutBodies.Reset();
+
+	TInlineComponentArray<UPrimitiveComponent*> Primitives;
+	GetOwner()->GetComponents(Primitives);
+
+	for (UPrimitiveComponent* Primitive : Primitives)
+	{
+		if (!Primitive->IsQueryCollisionEnabled() ||
+			Primitive->GetCollisionResponseToChannel(AtomCollisionChannels::InstantShot) == ECR_Ignore)
+		{
+			continue;
+		}
+
+		if (USkeletalMeshComponent* const SkeletalMesh = Cast<USkeletalMeshComponent>(Primitive))
+		{
+			for (FBodyInstance* Body : SkeletalMesh->Bodies)
+			{
+				if (Body && Body->IsValidBodyInstance() && !Body->IsInstanceSimulatingPhysics())
+				{
+					OutBodies.Add(Body);
+				}
+			}
+		}
+		else if (FBodyInstance* const Body = Primitive->GetBodyInstance())
+		{
+			if (Body->IsValidBodyInstance() && !Body->IsInstanceSimulatingPhysics())
+			{
+				OutBodies.Add(Body);
+			}
+		}
+	}
+}
+
+FScopedLagCompensation::FScopedLagCompensation(AAtomCharacter* Shooter, float AdditionalRewindTime /*= 0.f*/)
+{
+	if (Shooter == nullptr || Shooter->IsLocallyControlled() || Shooter->PlayerState == nullptr)
+		return;
+
+	UWorld* const World = Shooter->GetWorld();
+
+	// ExactPing is the round trip in ms. The shooter sees others half a trip late and the shot arrives
+	// half a trip later, so the full round trip is rewound.
+	const float ShooterLatency = Shooter->PlayerState->ExactPing * 0.001f + AdditionalRewindTime;
+
+	for (TActorIterator<AAtomCharacter> It{ World }; It; ++It)
+	{
+		AAtomCharacter* const Character = *It;
+		if (Character == Shooter)
+			continue;
+
+		UAtomLagCompensationComponent* const LagCompensation = Character->GetLagCompensation();
+		if (LagCompensation)
+		{
+			// The shooter saw the character through its interpolation buffer, so it is rewound by the buffer delay too
+			const float RewindTime = FMath::Min(ShooterLatency + LagCompensation->GetInterpolationDelay(), LagCompensation->GetMaxRewindTime());
+			if (RewindTime > 0.f && LagCompensation->RewindTo(World->GetTimeSeconds() - RewindTime))
+			{
+				RewoundComponents.Add(LagCompensation);
+			}
+		}
+	}
+}
+
+FScopedLagCompensation::~FScopedLagCompensation()
+{
+	for (UAtomLagCompensationComponent* LagCompensation : RewoundComponents)
+	{
+		LagCompensation->Restore();
+	}
+}
@@ -5,69 +5,60 @@
 
 #include "AtomLoadoutTemplate.h"
 #include "Equippables/AtomEquippable.h"
+#include "Equippables/AtomEquippablePool.h"
 #include "Haptics/HapticFeedbackEffect_Curve.h"
 #include "Components/StaticMeshComponent.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogLoadout, Log, All);
 
-namespace
-{
-	static const FColor TriggerBaseColor{ 100, 255, 100, 255 };
+DECLARE_CYCLE_STAT(TEXT("Loadout Replication Diff"), STAT_LoadoutReplicationDiff, STATGROUP_ProjectAtom);
 
-	struct FSavedLoadoutSlot
-	{
-		AAtomEquippable* Item;
-		uint32 Count;
-	};
+const FAtomLoadoutSlot UAtomLoadout::NullLoadoutSlot;
 
-	bool operator==(const FSavedLoadoutSlot& SavedSlot, const FAtomLoadoutSlot& Slot)
+void FAtomLoadoutSlotRep::PostReplicatedAdd(const FAtomLoadoutSlotArray& InArraySerializer)
+{
+	if (InArraySerializer.Loadout)
 	{
-		return SavedSlot.Item == Slot.Item && SavedSlot.Count == Slot.Count;
+		InArraySerializer.Loadout->OnSlotReplicated(SlotIndex, Item, Count);
 	}
+}
 
-	bool operator!=(const FSavedLoadoutSlot& SavedSlot, const FAtomLoadoutSlot& Slot)
+void FAtomLoadoutSlotRep::PostReplicatedChange(const FAtomLoadoutSlotArray& InArraySerializer)
+{
+	if (InArraySerializer.Loadout)
 	{
-		return !(SavedSlot == Slot);
+		InArraySerializer.Loadout->OnSlotReplicated(SlotIndex, Item, Count);
 	}
-
-	static TArray<FSavedLoadoutSlot> SavedLoadout;
 }
 
-const FAtomLoadoutSlot UAtomLoadout::NullLoadoutSlot;
-
-void UAtomLoadout::CreateLoadoutTriggers(const TArray<FAtomLoadoutTemplateSlot>& LoadoutTemplateSlots)
+void FAtomLoadoutSlotRep::PreReplicatedRemove(const FAtomLoadoutSlotArray& InArraySerializer)
 {
-	check(CharacterOwner->IsLocallyControlled());
-
-	for (int32 i = 0; i < LoadoutTemplateSlots.Num(); ++i)
+	if (InArraySerializer.Loadout)
 	{
-		USphereComponent* Trigger = NewObject<USphereComponent>(CharacterOwner);
-		Trigger->SetIsReplicated(false);
-
-		Trigger->RegisterComponent();
-
-		Trigger->SetSphereRadius(LoadoutTemplateSlots[i].StorageTriggerRadius);
-		Trigger->SetCollisionProfileName(AtomCollisionProfiles::HandTrigger);		
-		Trigger->bGenerateOverlapEvents = true;
-		Trigger->ShapeColor = TriggerBaseColor;
-		//Trigger->SetHiddenInGame(false);
-
-		Trigger->OnComponentBeginOverlap.AddDynamic(this, &UAtomLoadout::OnLoadoutTriggerOverlap);		
-
-		Trigger->AttachToComponent(GetAttachParent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, 
-			LoadoutTemplateSlots[i].StorageSocket);
-
-		Loadout[i].StorageTrigger = Trigger;
+		InArraySerializer.Loadout->OnSlotReplicated(SlotIndex, nullptr, 0);
 	}
 }
 
 void UAtomLoadout::InitializeLoadout(class AAtomCharacter* Owner)
 {
 	CharacterOwner = Owner;
+	ReplicatedSlots.Loadout = this;
 
 	if (LoadoutTemplate)
 	{
 		Loadout.SetNum(GetTemplateSlots().Num());
+		check(Loadout.Num() <= MAX_uint8);
+
+		if (CharacterOwner->HasAuthority())
+		{
+			ReplicatedSlots.Items.SetNum(Loadout.Num());
+
+			for (int32 i = 0; i < Loadout.Num(); ++i)
+			{
+				ReplicatedSlots.Items[i].SlotIndex = static_cast<uint8>(i);
+				ReplicatedSlots.MarkItemDirty(ReplicatedSlots.Items[i]);
+			}
+		}
 	}
 }
 
@@ -81,10 +72,11 @@ void UAtomLoadout::SpawnLoadout()
 
 		if (CharacterOwner->IsLocallyControlled())
 		{
-			UE_LOG(LogLoadout, Log, TEXT("Loadout triggers created on %s for %s"), 
+			UE_LOG(LogLoadout, Log, TEXT("Loadout storage activated on %s for %s"), 
 				*CharacterOwner->GetController()->GetName(), *CharacterOwner->GetName());
 
-			CreateLoadoutTriggers(LoadoutTemplateSlots);
+			SetStorageActive(true);
+			UpdateAllSlotOffsets();
 		}
 
 		// Weapons will only be spawned by server
@@ -100,30 +92,100 @@ void UAtomLoadout::DisableLoadout()
 	if (CharacterOwner == nullptr || !CharacterOwner->IsLocallyControlled())
 		return;
 
-	for (auto& Slot : Loadout)
+	SetStorageActive(false);
+}
+
+void UAtomLoadout::SetStorageActive(bool bIsActive)
+{
+	bIsStorageActive = bIsActive;
+
+	HandStorageSlots[0] = INDEX_NONE;
+	HandStorageSlots[1] = INDEX_NONE;
+}
+
+int32 UAtomLoadout::FindStorageSlot(const UPrimitiveComponent* OverlapComponent) const
+{
+	int32 NearestIndex = INDEX_NONE;
+	float NearestDistSquared = MAX_flt;
+
+	for (int32 i = 0; i < Loadout.Num(); ++i)
 	{
-		if (Slot.StorageTrigger)
-			Slot.StorageTrigger->Deactivate();
+		float DistSquared;
+		if (IsOverlappingStorage(i, OverlapComponent, DistSquared) && DistSquared < NearestDistSquared)
+		{
+			NearestIndex = i;
+			NearestDistSquared = DistSquared;
+		}
 	}
+
+	return NearestIndex;
+}
+
+bool UAtomLoadout::IsOverlappingStorage(int32 SlotIndex, const UPrimitiveComponent* OverlapComponent, float& OutDistSquared) const
+{
+	if (!bIsStorageActive || OverlapComponent == nullptr)
+		return false;
+
+	// Storage volumes are spheres relative to the body mesh, so overlaps are tested against the bounding sphere
+	// of the component rather than through physics.
+	const FTransform& BodyTransform = CharacterOwner->GetBodyMesh()->GetComponentTransform();
+	const FAtomLoadoutSlot& Slot = Loadout[SlotIndex];
+
+	const FVector StorageCenter = BodyTransform.TransformPosition(Slot.StorageLocation);
+	const float StorageRadius = Slot.StorageRadius * BodyTransform.GetMinimumAxisScale();
+	const FBoxSphereBounds& Bounds = OverlapComponent->Bounds;
+
+	OutDistSquared = FVector::DistSquared(Bounds.Origin, StorageCenter);
+	return OutDistSquared <= FMath::Square(Bounds.SphereRadius + StorageRadius);
 }
 
-void UAtomLoadout::DestroyLoadout()
+void UAtomLoadout::ReleaseLoadout()
 {
+	ReleaseLoadoutItems();
+
 	for (FAtomLoadoutSlot& Slot : Loadout)
 	{
-		if (Slot.StorageTrigger != nullptr)
-		{
-			Slot.StorageTrigger->DestroyComponent();
-			Slot.StorageTrigger = nullptr;
-		}
+		Slot.OnSlotChanged.Clear();
+	}
+}
+
+void UAtomLoadout::ResetLoadout()
+{
+	check(CharacterOwner && CharacterOwner->HasAuthority());
+
+	// Slot delegates are kept, the character and anything bound to it live on
+	ReleaseLoadoutItems();
+
+	if (LoadoutTemplate)
+	{
+		CreateLoadoutEquippables(GetTemplateSlots());
+	}
+}
+
+void UAtomLoadout::ReleaseLoadoutItems()
+{
+	const bool bHasAuthority = CharacterOwner->HasAuthority();
+	AAtomEquippablePool* const EquippablePool = bHasAuthority ? AAtomEquippablePool::Get(CharacterOwner) : nullptr;
 
+	for (FAtomLoadoutSlot& Slot : Loadout)
+	{
 		if (Slot.Item != nullptr)
 		{
-			Slot.Item->Destroy();
+			// Remotes follow the server through replication
+			if (bHasAuthority)
+			{
+				if (EquippablePool != nullptr && Slot.Item->CanBePooled())
+				{
+					EquippablePool->ReleaseEquippable(Slot.Item, 0.f);
+				}
+				else
+				{
+					Slot.Item->Destroy();
+				}
+			}
+
 			Slot.Item = nullptr;
 		}
-
-		Slot.OnSlotChanged.Clear();
 	}
 }
 
@@ -131,15 +193,16 @@ bool UAtomLoadout::RequestEquip(UPrimitiveComponent* OverlapComponent, const EHa
 {
 	check(CharacterOwner->IsLocallyControlled());
 
-	for (FAtomLoadoutSlot& Slot : Loadout)
+	const int32 SlotIndex = FindStorageSlot(OverlapComponent);
+	if (SlotIndex != INDEX_NONE)
 	{
-		if (Slot.Item && Slot.Item->CanEquip(Hand) &&
-			OverlapComponent->IsOverlappingComponent(Slot.StorageTrigger))
+		const FAtomLoadoutSlot& Slot = Loadout[SlotIndex];
+		if (Slot.Item && Slot.Item->CanEquip(Hand))
 		{
 			CharacterOwner->Equip(Slot.Item, Hand);
 			return true;
 		}
-	}	
+	}
 
 	return false;
 }
@@ -148,11 +211,12 @@ bool UAtomLoadout::RequestUnequip(UPrimitiveComponent* OverlapComponent, AAtomEq
 {
 	check(CharacterOwner->IsLocallyControlled());
 
-	const FAtomLoadoutSlot* Slot = Loadout.FindByPredicate([Item](const FAtomLoadoutSlot& Slot) { return Slot.Item == Item; });
+	const int32 SlotIndex = GetItemIndex(Item);
 
-	if (Slot && OverlapComponent->IsOverlappingComponent(Slot->StorageTrigger))
+	float DistSquared;
+	if (SlotIndex != INDEX_NONE && IsOverlappingStorage(SlotIndex, OverlapComponent, DistSquared))
 	{
-		CharacterOwner->Unequip(Slot->Item, Slot->Item->GetEquippedHand());
+		CharacterOwner->Unequip(Item, Item->GetEquippedHand());
 		return true;
 	}
 
@@ -174,10 +238,9 @@ void UAtomLoadout::OnCharacterControllerChanged()
 			UE_LOG(LogLoadout, Log, TEXT("OnCharacterControllerChanged() updating loadout for %s controller."), 
 				CharacterOwner->GetController() ? *CharacterOwner->GetController()->GetName() : TEXT("nullptr"));			
 
-			// Create triggers if needed
-			if (!Loadout[0].StorageTrigger)
+			if (!bIsStorageActive)
 			{
-				CreateLoadoutTriggers(TemplateSlots);
+				SetStorageActive(true);
 			}
 
 			// Update all attachments
@@ -201,17 +264,13 @@ void UAtomLoadout::OnCharacterControllerChanged()
 		UE_LOG(LogLoadout, Log, TEXT("OnCharacterControllerChanged() updating loadout for %s controller."), 
 			CharacterOwner->GetController() ? *CharacterOwner->GetController()->GetName() : TEXT("nullptr"));
 
+		// Only the controlling player interacts with storage
+		SetStorageActive(false);
+
 		for (int32 i = 0; i < Loadout.Num(); ++i)
 		{
 			FAtomLoadoutSlot& Slot = Loadout[i];
 
-			// Any triggers should be deleted
-			if (Slot.StorageTrigger)
-			{
-				Slot.StorageTrigger->DestroyComponent();
-				Slot.StorageTrigger = nullptr;
-			}				
-
 			if (Slot.Item)
 			{
 				Slot.Item->AttachToComponent(GetAttachParent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, 
@@ -241,7 +300,7 @@ void UAtomLoadout::ReturnToLoadout(const AAtomEquippable* Item)
 	check(Index != INDEX_NONE);
 
 	const auto& TemplateSlot = GetTemplateSlots()[Index];
-	const auto& Slot = Loadout[Index];
+	auto& Slot = Loadout[Index];
 
 	Slot.Item->AttachToComponent(GetAttachParent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale,
 		TemplateSlot.StorageSocket);
@@ -273,28 +332,31 @@ void UAtomLoadout::DiscardFromLoadout(const AAtomEquippable* Item)
 		// We have more, spawn one
 		--Slot.Count;
 
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.Instigator = CharacterOwner;
-		SpawnParams.Owner = CharacterOwner;
+		AAtomEquippablePool* const EquippablePool = AAtomEquippablePool::Get(CharacterOwner);
+		Slot.Item = EquippablePool ? EquippablePool->SpawnEquippable(TemplateSlot.ItemClass, FTransform::Identity, CharacterOwner) : nullptr;
 
-		Slot.Item = GetWorld()->SpawnActor<AAtomEquippable>(TemplateSlot.ItemClass, FTransform::Identity, SpawnParams);
-		Slot.Item->AttachToComponent(GetAttachParent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, TemplateSlot.StorageSocket);
-		
-		if (CharacterOwner->IsLocallyControlled())
+		if (Slot.Item != nullptr)
 		{
-			// Offset if locally controlled
-			const UStaticMeshComponent* BodyMesh = CharacterOwner->GetBodyMesh();
-			FVector ItemSocketOffset = BodyMesh->GetSocketTransform(TemplateSlot.StorageSocket, RTS_Component).GetLocation();
-			ItemSocketOffset = ItemSocketOffset.GetSafeNormal2D() * LoadoutSlotOffset;
-			Slot.Item->SetActorRelativeLocation(ItemSocketOffset);
-		}		
+			Slot.Item->AttachToComponent(GetAttachParent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, TemplateSlot.StorageSocket);
+
+			if (CharacterOwner->IsLocallyControlled())
+			{
+				// Offset if locally controlled
+				const UStaticMeshComponent* BodyMesh = CharacterOwner->GetBodyMesh();
+				FVector ItemSocketOffset = BodyMesh->GetSocketTransform(TemplateSlot.StorageSocket, RTS_Component).GetLocation();
+				ItemSocketOffset = ItemSocketOffset.GetSafeNormal2D() * LoadoutSlotOffset;
+				Slot.Item->SetActorRelativeLocation(ItemSocketOffset);
+			}
+		}
 
+		MarkSlotDirty(Index);
 		Slot.OnSlotChanged.Broadcast(ELoadoutSlotChangeType::Count | ELoadoutSlotChangeType::Item);
 	}
 	else
 	{
 		Slot.Item = nullptr;
 
+		MarkSlotDirty(Index);
 		Slot.OnSlotChanged.Broadcast(ELoadoutSlotChangeType::Item);
 	}
 }
@@ -364,42 +426,30 @@ USceneComponent* UAtomLoadout::GetAttachParent() const
 	return CharacterOwner->GetBodyAttachmentComponent();
 }
 
-void UAtomLoadout::PreNetReceive()
-{
-	Super::PreNetReceive();
-
-	SavedLoadout.SetNum(Loadout.Num(), false);
-
-	for (int i = 0; i < Loadout.Num(); ++i)
-	{
-		SavedLoadout[i].Item = Loadout[i].Item;
-		SavedLoadout[i].Count = Loadout[i].Count;
-	}
-}
-
 class UWorld* UAtomLoadout::GetWorld() const
 {
 	return CharacterOwner ? CharacterOwner->GetWorld() : nullptr;
 }
 
-void UAtomLoadout::OnLoadoutTriggerOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+void UAtomLoadout::UpdateHandStorageOverlaps()
 {
-	FAtomLoadoutSlot* const OverlappedSlot = Loadout.FindByPredicate([OverlappedComponent](const FAtomLoadoutSlot& Slot) { return Slot.StorageTrigger == OverlappedComponent; });
-
-	// Try to get the loadout item
-	AAtomEquippable* const OverlappedItem = OverlappedSlot ? OverlappedSlot->Item : nullptr;
+	if (!bIsStorageActive)
+		return;
 
-	if (OverlappedItem)
+	for (EHand Hand : { EHand::Left, EHand::Right })
 	{
-		EControllerHand ControllerHand = EControllerHand::Left;
-		EHand Hand = EHand::Left;
+		const int32 SlotIndex = FindStorageSlot(CharacterOwner->GetHandTrigger(Hand));
+		int32& LastSlotIndex = HandStorageSlots[static_cast<uint8>(Hand)];
 
-		ensureMsgf(OtherComp == CharacterOwner->GetHandTrigger<EHand::Right>() || OtherComp == CharacterOwner->GetHandTrigger<EHand::Left>(), TEXT("Loadout slot triggers should only overlapped hero hand triggers. Check your collision setups."));
-		if (OtherComp == CharacterOwner->GetHandTrigger<EHand::Right>())
-		{
-			ControllerHand = EControllerHand::Right;
-			Hand = EHand::Right;
-		}
+		// Only give feedback when entering a new storage volume
+		if (SlotIndex == LastSlotIndex)
+			continue;
+
+		LastSlotIndex = SlotIndex;
+
+		AAtomEquippable* const OverlappedItem = (SlotIndex != INDEX_NONE) ? Loadout[SlotIndex].Item : nullptr;
+		if (OverlappedItem == nullptr)
+			continue;
 
 		// Check if the item can be equipped. If it is already equipped, check if the overlapped hand has the item equipped.
 		const AAtomEquippable* CurrentlyEquipped = CharacterOwner->GetEquippable(Hand);
@@ -408,11 +458,11 @@ void UAtomLoadout::OnLoadoutTriggerOverlap(UPrimitiveComponent* OverlappedCompon
 			(OverlappedItem->IsEquipped() && CurrentlyEquipped == OverlappedItem))
 		{
 			APlayerController* const PC = Cast<APlayerController>(CharacterOwner->GetController());
-			ensureMsgf(PC != nullptr && PC->IsLocalController(), TEXT("Loadout trigger overlaps should only occur on locally controlled heros."));
+			ensureMsgf(PC == nullptr || PC->IsLocalController(), TEXT("Loadout storage should only be active on locally controlled heros."));
 
 			if (PC && TriggerFeedback)
 			{
-				PC->PlayHapticEffect(TriggerFeedback, ControllerHand);
+				PC->PlayHapticEffect(TriggerFeedback, (Hand == EHand::Left) ? EControllerHand::Left : EControllerHand::Right);
 			}
 		}
 	}
@@ -420,12 +470,8 @@ void UAtomLoadout::OnLoadoutTriggerOverlap(UPrimitiveComponent* OverlappedCompon
 
 void UAtomLoadout::CreateLoadoutEquippables(const TArray<FAtomLoadoutTemplateSlot>& LoadoutTemplateSlots)
 {
-	if (UWorld* const World = GetWorld())
+	if (AAtomEquippablePool* const EquippablePool = AAtomEquippablePool::Get(CharacterOwner))
 	{
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.Instigator = CharacterOwner;
-		SpawnParams.Owner = CharacterOwner;
-
 		for (int32 i = 0; i < LoadoutTemplateSlots.Num(); ++i)
 		{
 			const FAtomLoadoutTemplateSlot& TemplateSlot = LoadoutTemplateSlots[i];
@@ -433,12 +479,20 @@ void UAtomLoadout::CreateLoadoutEquippables(const TArray<FAtomLoadoutTemplateSlo
 
 			if (TemplateSlot.ItemClass)
 			{
-				AAtomEquippable* const Equippable = GetWorld()->SpawnActor<AAtomEquippable>(TemplateSlot.ItemClass, FTransform::Identity, SpawnParams);
+				AAtomEquippable* const Equippable = EquippablePool->SpawnEquippable(TemplateSlot.ItemClass, FTransform::Identity, CharacterOwner);
+				if (Equippable == nullptr)
+				{
+					UE_LOG(LogLoadout, Warning, TEXT("Failed to spawn %s for loadout slot %d."), *TemplateSlot.ItemClass->GetName(), i);
+					continue;
+				}
+
 				Equippable->AttachToComponent(GetAttachParent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale, TemplateSlot.StorageSocket);			
 
 				CurrentSlot.Item = Equippable;
 				CurrentSlot.Count = TemplateSlot.Count;			
 
+				MarkSlotDirty(i);
+
 				CurrentSlot.OnSlotChanged.Broadcast(ELoadoutSlotChangeType::Item | ELoadoutSlotChangeType::Count);
 			}
 			else
@@ -464,7 +518,7 @@ void UAtomLoadout::UpdateAllSlotOffsets()
 	}
 }
 
-void UAtomLoadout::UpdateSlotOffset(const FAtomLoadoutSlot& Slot, const FAtomLoadoutTemplateSlot& TemplateSlot)
+void UAtomLoadout::UpdateSlotOffset(FAtomLoadoutSlot& Slot, const FAtomLoadoutTemplateSlot& TemplateSlot)
 {
 	// Only happens on local controllers
 	UStaticMeshComponent* BodyMesh = CharacterOwner->GetBodyMesh();
@@ -479,10 +533,9 @@ void UAtomLoadout::UpdateSlotOffset(const FAtomLoadoutSlot& Slot, const FAtomLoa
 			Slot.Item->SetActorRelativeLocation(SocketOffset);
 		}
 
-		if (Slot.StorageTrigger)
-		{
-			Slot.StorageTrigger->SetRelativeLocation(SocketOffset);
-		}		
+		// Socket transforms on the body mesh are fixed, so storage volumes only move with the loadout offset
+		Slot.StorageLocation = SocketTransform.TransformPosition(SocketOffset);
+		Slot.StorageRadius = TemplateSlot.StorageTriggerRadius;
 	}
 
 	if (Slot.UIRoot.IsValid())
@@ -501,48 +554,68 @@ const TArray<FAtomLoadoutTemplateSlot>& UAtomLoadout::GetTemplateSlots() const
 	return LoadoutTemplateCDO->GetLoadoutSlots();
 }
 
-void UAtomLoadout::OnRep_Loadout()
+void UAtomLoadout::MarkSlotDirty(int32 SlotIndex)
 {
-	for (int i = 0; i < Loadout.Num(); ++i)
+	check(CharacterOwner->HasAuthority());
+
+	const FAtomLoadoutSlot& Slot = Loadout[SlotIndex];
+	FAtomLoadoutSlotRep& SlotRep = ReplicatedSlots.Items[SlotIndex];
+
+	if (SlotRep.Item != Slot.Item || SlotRep.Count != Slot.Count)
 	{
-		ELoadoutSlotChangeType Change = ELoadoutSlotChangeType::None;
+		SlotRep.Item = Slot.Item;
+		SlotRep.Count = Slot.Count;
+		ReplicatedSlots.MarkItemDirty(SlotRep);
+	}
+}
 
-		FAtomLoadoutSlot& Slot = Loadout[i];
+void UAtomLoadout::OnSlotReplicated(int32 SlotIndex, AAtomEquippable* Item, int32 Count)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LoadoutReplicationDiff);
 
-		if (SavedLoadout[i].Item != Slot.Item)
-		{
-			Change |= ELoadoutSlotChangeType::Item;
+	if (!ensureMsgf(Loadout.IsValidIndex(SlotIndex), TEXT("Received loadout slot %d before the loadout was initialized."), SlotIndex))
+		return;
 
-			const FAtomLoadoutTemplateSlot& TemplateSlot = GetTemplateSlots()[i];
+	FAtomLoadoutSlot& Slot = Loadout[SlotIndex];
+	ELoadoutSlotChangeType Change = ELoadoutSlotChangeType::None;
 
-			// Update local attachment only if not equipped. It may be equipped for late joining remotes.
-			if (Slot.Item && !Slot.Item->IsEquipped())
-			{
-				Slot.Item->AttachToComponent(GetAttachParent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale,
-					TemplateSlot.StorageSocket);				
-			}			
+	if (Slot.Item != Item)
+	{
+		Change |= ELoadoutSlotChangeType::Item;
+		Slot.Item = Item;
 
-			if (CharacterOwner->IsLocallyControlled())
-			{
-				UpdateSlotOffset(Slot, TemplateSlot);
-			}
-		}			
+		const FAtomLoadoutTemplateSlot& TemplateSlot = GetTemplateSlots()[SlotIndex];
 
-		if (SavedLoadout[i].Count != Slot.Count)
-			Change |= ELoadoutSlotChangeType::Count;
+		// Update local attachment only if not equipped. It may be equipped for late joining remotes.
+		if (Slot.Item && !Slot.Item->IsEquipped())
+		{
+			Slot.Item->AttachToComponent(GetAttachParent(), FAttachmentTransformRules::SnapToTargetNotIncludingScale,
+				TemplateSlot.StorageSocket);				
+		}			
 
-		if (Change != ELoadoutSlotChangeType::None)
+		if (CharacterOwner->IsLocallyControlled())
 		{
-			Slot.OnSlotChanged.Broadcast(Change);
+			UpdateSlotOffset(Slot, TemplateSlot);
 		}
 	}
+
+	if (Slot.Count != Count)
+	{
+		Change |= ELoadoutSlotChangeType::Count;
+		Slot.Count = Count;
+	}
+
+	if (Change != ELoadoutSlotChangeType::None)
+	{
+		Slot.OnSlotChanged.Broadcast(Change);
+	}
 }
 
 void UAtomLoadout::GetLifetimeReplicatedProps(TArray<class FLifetimeProperty> & OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(UAtomLoadout, Loadout);
+	DOREPLIFETIME(UAtomLoadout, ReplicatedSlots);
 }
 
 bool UAtomLoadout::IsSupportedForNetworking() const
@@ -5,6 +5,7 @@
 
 #include "AI/Navigation/AvoidanceManager.h"
 #include "HMDCapsuleComponent.h"
+#include "TeleportMovementType.h"
 #include "UObjectBaseUtility.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogHeroMovement, Log, All);
@@ -106,12 +107,61 @@ void UAtomCharacterMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
 	Super::UpdateFromCompressedFlags(Flags);
 
 	bWantsToTeleport = (Flags & FSavedMove_AtomCharacter::FLAG_WantsToTeleport) != 0;
-	if (bWantsToTeleport)
+
+	// Clients replaying moves already have the destination from the saved move
+	if (bWantsToTeleport && CharacterOwner->Role == ROLE_Authority)
 	{
 		FNetworkPredictionData_Server_AtomCharacter* ServerData = GetPredictionData_Server_Hero();
 		check(ServerData);
-		PendingTeleportDestination = ServerData->ClientLocation;
+
+		bWantsToTeleport = IsValidTeleport(ServerData->ClientLocation);
+
+		if (bWantsToTeleport)
+		{
+			PendingTeleportDestination = ServerData->ClientLocation;
+			LastTeleportTime = GetWorld()->GetTimeSeconds();
+		}
+	}
+}
+
+bool UAtomCharacterMovementComponent::IsValidTeleport(const FVector& Destination) const
+{
+	// Client time stamps can be chosen by the client, so the cooldown uses server time
+	if (LastTeleportTime >= 0.f && GetWorld()->GetTimeSeconds() - LastTeleportTime < TeleportCooldown)
+	{
+		UE_LOG(LogHeroMovement, Log, TEXT("Rejected teleport by %s, cooldown"), *GetNameSafe(CharacterOwner));
+		return false;
 	}
+
+	if (FVector::DistSquaredXY(UpdatedComponent->GetComponentLocation(), Destination) > FMath::Square(GetMaxTeleportDistance()))
+	{
+		UE_LOG(LogHeroMovement, Log, TEXT("Rejected teleport by %s, out of range"), *GetNameSafe(CharacterOwner));
+		return false;
+	}
+
+	if (UNavigationSystem* const NavSystem = GetWorld()->GetNavigationSystem())
+	{
+		// Destination is the capsule center, so the navmesh is up to a half height below it
+		const float HalfHeight = CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+		const FVector NavExtent{ TeleportNavTolerance, TeleportNavTolerance, HalfHeight + MaxStepHeight };
+
+		FNavLocation NavLocation;
+		if (!NavSystem->ProjectPointToNavigation(Destination, NavLocation, NavExtent))
+		{
+			UE_LOG(LogHeroMovement, Log, TEXT("Rejected teleport by %s, off navmesh"), *GetNameSafe(CharacterOwner));
+			return false;
+		}
+	}
+
+	return true;
+}
+
+float UAtomCharacterMovementComponent::GetMaxTeleportDistance() const
+{
+	// The capsule moves by the arc hit minus the head location, and the arc starts at the hand, so a teleport
+	// covers at most the arc range plus the hand's reach from the head.
+	const UTeleportMovementType* const TeleportMovement = CharacterOwner->FindComponentByClass<UTeleportMovementType>();
+	return TeleportMovement ? TeleportMovement->GetMaxArcDistance() + TeleportReach : 0.f;
 }
 
 void UAtomCharacterMovementComponent::OnMovementUpdated(float DeltaSeconds, const FVector& OldLocation, const FVector& OldVelocity)
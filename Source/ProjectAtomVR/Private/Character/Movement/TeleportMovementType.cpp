@@ -49,102 +49,126 @@ void UTeleportMovementType::TickComponent(float DeltaTime, enum ELevelTick TickT
 
 	if (bIsTeleportActive)
 	{
-		FHitResult Hit;
-		TArray<FVector> ArcPath;
-
-		bIsTargetValid = false;
-		FPredictProjectilePathResult PathResult;
-		if (TraceArcPath(Hit, PathResult))
-		{		
-			UpdateTeleportActor(PathResult.HitResult);
+		// The arc is traced at a fixed rate. Spline meshes are attached to the hand, so the arc follows it in between.
+		TimeSinceArcUpdate += DeltaTime;
+
+		if (TimeSinceArcUpdate >= 1.f / FMath::Max(ArcUpdateRate, 1.f))
+		{
+			TimeSinceArcUpdate = 0.f;
+			UpdateArc();
 		}
+	}
+}
+
+void UTeleportMovementType::UpdateArc()
+{
+	bIsTargetValid = false;
 
-		TeleportActor->SetActorHiddenInGame(!bIsTargetValid);
+	FHitResult Hit;
+	if (TraceArcPath(Hit, ArcPathResult))
+	{		
+		UpdateTeleportActor(Hit);
+	}
 
-		UpdateArcSpline(ArcPath);
+	TeleportActor->SetActorHiddenInGame(!bIsTargetValid);
+
+	ArcPoints.Reset();
+	for (const FPredictProjectilePathPointData& PathPoint : ArcPathResult.PathData)
+	{
+		ArcPoints.Add(PathPoint.Location);
 	}
+
+	UpdateArcSpline(ArcPoints);
 }
 
 bool UTeleportMovementType::TraceArcPath(FHitResult& OutHit, FPredictProjectilePathResult& PathResult)
 {
-	FPredictProjectilePathParams PredictParams{ 0.f, ArcSpline->GetComponentLocation(), ArcSpline->GetForwardVector() * TeleportArcVelocity, 2.5f };
-	PredictParams.SimFrequency = 7.f;
+	FPredictProjectilePathParams PredictParams{ 0.f, ArcSpline->GetComponentLocation(), ArcSpline->GetForwardVector() * TeleportArcVelocity, ArcMaxSimTime };
+	PredictParams.SimFrequency = ArcSimFrequency;
+
+	const bool bHit = UGameplayStatics::PredictProjectilePath(this, PredictParams, PathResult);
+	OutHit = PathResult.HitResult;
 
-	return UGameplayStatics::PredictProjectilePath(this, PredictParams, PathResult);
+	return bHit;
 }
 
 void UTeleportMovementType::UpdateArcSpline(const TArray<FVector>& ArcPath)
 {
-	// Update the spline component with new points
-	ArcSpline->ClearSplinePoints();
+	CreateArcSegments();
+
+	// Update the spline component with new points, resampling long paths to fit the segment pool
+	ArcSpline->ClearSplinePoints(false);
 
-	for (const auto& Point : ArcPath)
+	const int32 NumPoints = FMath::Min(ArcPath.Num(), SplineMeshes.Num() + 1);
+	const float PathStep = (NumPoints > 1) ? static_cast<float>(ArcPath.Num() - 1) / (NumPoints - 1) : 0.f;
+
+	for (int32 i = 0; i < NumPoints; ++i)
 	{
-		ArcSpline->AddSplinePoint(Point, ESplineCoordinateSpace::World, false);
+		const int32 PathIndex = (i == NumPoints - 1) ? ArcPath.Num() - 1 : FMath::RoundToInt(i * PathStep);
+		ArcSpline->AddSplinePoint(ArcPath[PathIndex], ESplineCoordinateSpace::World, false);
 	}	
 
-	const int32 ArcPathNum = ArcPath.Num();
-	const int32 SplineMeshNum = SplineMeshes.Num();
-	const uint32 LastIndex = ArcPathNum - 1;
-	ArcSpline->SetSplinePointType(LastIndex, ESplinePointType::CurveClamped);
+	if (NumPoints > 0)
+	{
+		ArcSpline->SetSplinePointType(NumPoints - 1, ESplinePointType::CurveClamped, false);
+	}
 
+	ArcSpline->UpdateSpline();
 
-	//----------------------------------------------------------------------------------------------
-	// Create/Update spline meshes using information from spline component
-	//----------------------------------------------------------------------------------------------
+	// Update spline meshes from the spline points. Meshes are attached to the spline, so they use its local space.
+	const int32 SplineMeshesNeeded = FMath::Max(NumPoints - 1, 0);
 
-	// Add/Remove meshes as needed
-	const int32 SplineMeshesNeeded = ArcPathNum - 1;
-	if (SplineMeshNum < SplineMeshesNeeded)
+	for (int32 i = 0; i < SplineMeshes.Num(); ++i)
 	{
-		// Add more meshes
-		const int32 NewMeshesNeeded = SplineMeshesNeeded - SplineMeshNum;
-		for (int32 i = 0; i < NewMeshesNeeded; ++i)
-		{
-			USplineMeshComponent* NewMesh = NewObject<USplineMeshComponent>(this);
-			NewMesh->SetMaterial(0, ArcMaterial);
-			NewMesh->SetStaticMesh(ArcMesh);
-			NewMesh->SetMobility(EComponentMobility::Movable);
-
-			NewMesh->RegisterComponent();
-			SplineMeshes.Add(NewMesh);
-			
-		}
-	}
-	else if (SplineMeshNum > SplineMeshesNeeded)
-	{	
-		constexpr int32 MeshBuffer = 4;
-		if (SplineMeshNum > SplineMeshesNeeded + MeshBuffer)
-		{
-			// Delete unneeded meshes if beyond buffer
-			for (int32 i = SplineMeshesNeeded; i < SplineMeshNum; ++i)
-			{
-				SplineMeshes[i]->DestroyComponent();
-			}
+		USplineMeshComponent* const SplineMesh = SplineMeshes[i];
 
-			SplineMeshes.RemoveAt(SplineMeshesNeeded, SplineMeshNum - SplineMeshesNeeded);
+		if (i < SplineMeshesNeeded)
+		{
+			FVector StartPos, StartTangent, EndPos, EndTangent;
+			ArcSpline->GetLocationAndTangentAtSplinePoint(i, StartPos, StartTangent, ESplineCoordinateSpace::Local);
+			ArcSpline->GetLocationAndTangentAtSplinePoint(i + 1, EndPos, EndTangent, ESplineCoordinateSpace::Local);
+			SplineMesh->SetStartAndEnd(StartPos, StartTangent, EndPos, EndTangent);
+			SplineMesh->SetHiddenInGame(false);
 		}
 		else
 		{
-			// Hide unneeded meshes
-			for (int32 i = SplineMeshesNeeded; i < SplineMeshNum; ++i)
-			{
-				SplineMeshes[i]->SetHiddenInGame(true);
-			}
+			SplineMesh->SetHiddenInGame(true);
 		}
 	}
+}
+
+void UTeleportMovementType::CreateArcSegments()
+{
+	if (SplineMeshes.Num() > 0)
+		return;
 
-	// Create meshes from spline points
-	for (int32 i = 0; i < SplineMeshesNeeded; ++i)
+	SplineMeshes.Reserve(MaxArcSegments);
+
+	for (int32 i = 0; i < FMath::Max(MaxArcSegments, 1); ++i)
 	{
-		USplineMeshComponent* SplineMesh = SplineMeshes[i];
+		USplineMeshComponent* const NewMesh = NewObject<USplineMeshComponent>(this);
+		NewMesh->SetMobility(EComponentMobility::Movable);
+		NewMesh->SetupAttachment(ArcSpline);
+		NewMesh->SetMaterial(0, ArcMaterial);
+		NewMesh->SetStaticMesh(ArcMesh);
+		NewMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		NewMesh->SetHiddenInGame(true);
+
+		NewMesh->RegisterComponent();
+		SplineMeshes.Add(NewMesh);
+	}
 
-		SplineMesh->SetHiddenInGame(false);
+	// Path buffers hold at most one point per simulation step plus the start and hit points
+	const int32 MaxPathPoints = FMath::CeilToInt(ArcMaxSimTime * ArcSimFrequency) + 2;
+	ArcPoints.Reserve(MaxPathPoints);
+	ArcPathResult.PathData.Reserve(MaxPathPoints);
+}
 
-		FVector StartPos, StartTangent, EndPos, EndTangent;
-		ArcSpline->GetLocationAndTangentAtSplinePoint(i, StartPos, StartTangent, ESplineCoordinateSpace::World);
-		ArcSpline->GetLocationAndTangentAtSplinePoint(i+1, EndPos, EndTangent, ESplineCoordinateSpace::World);
-		SplineMesh->SetStartAndEnd(StartPos, StartTangent, EndPos, EndTangent);
+void UTeleportMovementType::HideArcSegments()
+{
+	for (USplineMeshComponent* const SplineMesh : SplineMeshes)
+	{
+		SplineMesh->SetHiddenInGame(true);
 	}
 }
 
@@ -222,6 +246,10 @@ void UTeleportMovementType::OnTeleportPressed()
 		ArcSpline->AttachToComponent(GetCharacter()->GetHandController<EHandType::Nondominate>(), FAttachmentTransformRules::SnapToTargetNotIncludingScale);
 
 		bIsTeleportActive = true;
+
+		// Trace right away instead of waiting for the next arc update
+		UpdateArc();
+		TimeSinceArcUpdate = 0.f;
 	}
 }
 
@@ -245,12 +273,7 @@ void UTeleportMovementType::OnTeleportReleased()
 		ArcSpline->ClearSplinePoints();
 	}
 
-	for (auto Mesh : SplineMeshes)
-	{
-		Mesh->DestroyComponent();
-	}
-
-	SplineMeshes.Empty();
+	HideArcSegments();
 }
 
 void UTeleportMovementType::OnGripPressed()
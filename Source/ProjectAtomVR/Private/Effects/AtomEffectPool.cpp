@@ -0,0 +1,270 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#include "ProjectAtomVR.h"
+#include "AtomEffectPool.h"
+#include "AtomWorldPool.h"
+
+#include "Particles/ParticleSystemComponent.h"
+#include "Components/AudioComponent.h"
+#include "Components/DecalComponent.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogEffectPool, Log, All);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Effect Pool Hits"), STAT_EffectPoolHits, STATGROUP_ProjectAtom);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Effect Pool Misses"), STAT_EffectPoolMisses, STATGROUP_ProjectAtom);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Effect Pool Steals"), STAT_EffectPoolSteals, STATGROUP_ProjectAtom);
+
+namespace
+{
+	// Seconds between checks for expired decals
+	constexpr float DecalExpireCheckInterval = 0.25f;
+}
+
+static FAutoConsoleCommandWithWorld DumpEffectPoolCommand(
+	TEXT("s.DumpEffectPool"),
+	TEXT("Logs effect pool sizes and hit, miss, and steal counts"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (AAtomEffectPool* const EffectPool = TAtomWorldPool<AAtomEffectPool>::Find(World))
+		{
+			EffectPool->DumpStats();
+		}
+	}));
+
+AAtomEffectPool::AAtomEffectPool(const FObjectInitializer& ObjectInitializer /*= FObjectInitializer::Get()*/)
+	: Super(ObjectInitializer)
+{
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.TickInterval = DecalExpireCheckInterval;
+
+	bReplicates = false;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+AAtomEffectPool* AAtomEffectPool::Get(const UObject* WorldContextObject)
+{
+	return TAtomWorldPool<AAtomEffectPool>::Get(WorldContextObject, TEXT("EffectPool"));
+}
+
+void AAtomEffectPool::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	TAtomWorldPool<AAtomEffectPool>::Register(this);
+}
+
+void AAtomEffectPool::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	TAtomWorldPool<AAtomEffectPool>::Unregister(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AAtomEffectPool::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	// Return expired decals to the pool
+	LingeringDecals.RemoveExpired(GetWorld()->GetTimeSeconds(), [this](UDecalComponent* Decal)
+	{
+		Decal->SetVisibility(false);
+		ResetAttachment(Decal);
+	});
+}
+
+template <typename ComponentType, typename IsFreeFunc>
+int32 AAtomEffectPool::AcquireComponent(TArray<ComponentType*>& Components, TArray<float>& UseTimes, int32 MaxComponents, FPoolStats& Stats, IsFreeFunc IsFree)
+{
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
+
+	// Reuse a finished component
+	for (int32 i = 0; i < Components.Num(); ++i)
+	{
+		if (IsFree(Components[i]))
+		{
+			++Stats.Hits;
+			INC_DWORD_STAT(STAT_EffectPoolHits);
+
+			UseTimes[i] = CurrentTime;
+			return i;
+		}
+	}
+
+	// Grow the pool if under the cap
+	if (Components.Num() < FMath::Max(MaxComponents, 1))
+	{
+		++Stats.Misses;
+		INC_DWORD_STAT(STAT_EffectPoolMisses);
+
+		ComponentType* const NewComponent = NewObject<ComponentType>(this);
+		NewComponent->bAutoActivate = false;
+		NewComponent->SetupAttachment(RootComponent);
+		NewComponent->bAbsoluteLocation = true;
+		NewComponent->bAbsoluteRotation = true;
+		NewComponent->bAbsoluteScale = true;
+		NewComponent->RegisterComponent();
+
+		UseTimes.Add(CurrentTime);
+		return Components.Add(NewComponent);
+	}
+
+	// Steal the oldest
+	++Stats.Steals;
+	INC_DWORD_STAT(STAT_EffectPoolSteals);
+
+	int32 OldestIndex = 0;
+	for (int32 i = 1; i < UseTimes.Num(); ++i)
+	{
+		if (UseTimes[i] < UseTimes[OldestIndex])
+		{
+			OldestIndex = i;
+		}
+	}
+
+	UseTimes[OldestIndex] = CurrentTime;
+	return OldestIndex;
+}
+
+void AAtomEffectPool::ResetAttachment(USceneComponent* Component)
+{
+	if (Component->GetAttachParent() != RootComponent)
+	{
+		Component->AttachToComponent(RootComponent, FAttachmentTransformRules::KeepWorldTransform);
+		Component->bAbsoluteLocation = true;
+		Component->bAbsoluteRotation = true;
+		Component->bAbsoluteScale = true;
+	}
+}
+
+UParticleSystemComponent* AAtomEffectPool::SpawnEmitterAtLocation(UParticleSystem* Template, const FVector& Location, const FRotator& Rotation)
+{
+	if (Template == nullptr)
+		return nullptr;
+
+	const int32 Index = AcquireComponent(ParticleComponents, ParticleUseTimes, MaxParticleComponents, ParticleStats,
+		[](UParticleSystemComponent* Component) { return !Component->IsActive(); });
+
+	UParticleSystemComponent* const Component = ParticleComponents[Index];
+	Component->KillParticlesForced();
+	ResetAttachment(Component);
+
+	Component->SetTemplate(Template);
+	Component->SetWorldLocationAndRotation(Location, Rotation);
+	Component->ActivateSystem(true);
+
+	return Component;
+}
+
+UParticleSystemComponent* AAtomEffectPool::SpawnEmitterAttached(UParticleSystem* Template, USceneComponent* AttachToComponent, FName AttachPointName /*= NAME_None*/)
+{
+	if (Template == nullptr || AttachToComponent == nullptr)
+		return nullptr;
+
+	const int32 Index = AcquireComponent(ParticleComponents, ParticleUseTimes, MaxParticleComponents, ParticleStats,
+		[](UParticleSystemComponent* Component) { return !Component->IsActive(); });
+
+	UParticleSystemComponent* const Component = ParticleComponents[Index];
+	Component->KillParticlesForced();
+
+	Component->bAbsoluteLocation = false;
+	Component->bAbsoluteRotation = false;
+	Component->bAbsoluteScale = false;
+	Component->SetTemplate(Template);
+	Component->AttachToComponent(AttachToComponent, FAttachmentTransformRules::SnapToTargetNotIncludingScale, AttachPointName);
+	Component->ActivateSystem(true);
+
+	return Component;
+}
+
+UAudioComponent* AAtomEffectPool::SpawnSoundAtLocation(USoundBase* Sound, const FVector& Location, const FRotator& Rotation /*= FRotator::ZeroRotator*/)
+{
+	if (Sound == nullptr)
+		return nullptr;
+
+	const int32 Index = AcquireComponent(AudioComponents, AudioUseTimes, MaxAudioComponents, AudioStats,
+		[](UAudioComponent* Component) { return !Component->IsPlaying(); });
+
+	UAudioComponent* const Component = AudioComponents[Index];
+	Component->Stop();
+	ResetAttachment(Component);
+
+	Component->SetSound(Sound);
+	Component->SetWorldLocationAndRotation(Location, Rotation);
+	Component->Play();
+
+	return Component;
+}
+
+UAudioComponent* AAtomEffectPool::SpawnSoundAttached(USoundBase* Sound, USceneComponent* AttachToComponent, FName AttachPointName /*= NAME_None*/)
+{
+	if (Sound == nullptr || AttachToComponent == nullptr)
+		return nullptr;
+
+	const int32 Index = AcquireComponent(AudioComponents, AudioUseTimes, MaxAudioComponents, AudioStats,
+		[](UAudioComponent* Component) { return !Component->IsPlaying(); });
+
+	UAudioComponent* const Component = AudioComponents[Index];
+	Component->Stop();
+
+	Component->bAbsoluteLocation = false;
+	Component->bAbsoluteRotation = false;
+	Component->bAbsoluteScale = false;
+	Component->SetSound(Sound);
+	Component->AttachToComponent(AttachToComponent, FAttachmentTransformRules::SnapToTargetNotIncludingScale, AttachPointName);
+	Component->Play();
+
+	return Component;
+}
+
+UDecalComponent* AAtomEffectPool::SpawnDecalAttached(UMaterialInterface* DecalMaterial, const FVector& DecalSize, USceneComponent* AttachToComponent,
+	FName AttachPointName, const FVector& Location, const FRotator& Rotation, float LifeSpan)
+{
+	if (DecalMaterial == nullptr)
+		return nullptr;
+
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
+
+	const int32 Index = AcquireComponent(DecalComponents, DecalUseTimes, MaxDecalComponents, DecalStats,
+		[](UDecalComponent* Component) { return !Component->IsVisible(); });
+
+	UDecalComponent* const Component = DecalComponents[Index];
+	ResetAttachment(Component);
+
+	// A stolen decal drops the life span it was given before
+	if (LifeSpan > 0.f)
+	{
+		LingeringDecals.Add(Component, CurrentTime + LifeSpan);
+	}
+	else
+	{
+		LingeringDecals.Remove(Component);
+	}
+
+	Component->SetDecalMaterial(DecalMaterial);
+	Component->DecalSize = DecalSize;
+	Component->SetWorldLocationAndRotation(Location, Rotation);
+	Component->SetVisibility(true);
+
+	if (AttachToComponent)
+	{
+		Component->bAbsoluteLocation = false;
+		Component->bAbsoluteRotation = false;
+		Component->bAbsoluteScale = false;
+		Component->AttachToComponent(AttachToComponent, FAttachmentTransformRules::KeepWorldTransform, AttachPointName);
+	}
+
+	Component->MarkRenderStateDirty();
+
+	return Component;
+}
+
+void AAtomEffectPool::DumpStats() const
+{
+	UE_LOG(LogEffectPool, Log, TEXT("Particles: %d/%d components, %u hits, %u misses, %u steals"),
+		ParticleComponents.Num(), MaxParticleComponents, ParticleStats.Hits, ParticleStats.Misses, ParticleStats.Steals);
+	UE_LOG(LogEffectPool, Log, TEXT("Audio: %d/%d components, %u hits, %u misses, %u steals"),
+		AudioComponents.Num(), MaxAudioComponents, AudioStats.Hits, AudioStats.Misses, AudioStats.Steals);
+	UE_LOG(LogEffectPool, Log, TEXT("Decals: %d/%d components, %u hits, %u misses, %u steals"),
+		DecalComponents.Num(), MaxDecalComponents, DecalStats.Hits, DecalStats.Misses, DecalStats.Steals);
+}
@@ -4,17 +4,20 @@
 #include "AtomImpactEffect.h"
 
 #include "PhysicalMaterials/PhysicalMaterial.h"
+#include "AtomEffectPool.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogImpactEffect, Log, All);
 
 void UAtomImpactEffect::SpawnEffect(UWorld* World, const FHitResult& Hit) const
 {
+	AAtomEffectPool* const EffectPool = AAtomEffectPool::Get(World);
+
 	if (!World)
 	{
 		UE_LOG(LogImpactEffect, Warning, 
 			TEXT("AtomImpactEffect::SpawnEffect World parameter is invalid."));
 	}
-	else
+	else if (EffectPool)
 	{
 		const FMaterialEffect& Effect = GetEffect(Hit.PhysMaterial);
 		const FRotator Rotation = Hit.ImpactNormal.Rotation();
@@ -24,12 +27,12 @@ void UAtomImpactEffect::SpawnEffect(UWorld* World, const FHitResult& Hit) const
 			// Reflect the particle system on the surface
 			const FVector HitDirection = Hit.ImpactPoint - Hit.TraceStart;
 			const FVector ParticleDirection = HitDirection.MirrorByVector(Hit.ImpactNormal);
-			UGameplayStatics::SpawnEmitterAtLocation(World, Effect.Particles, Hit.ImpactPoint, ParticleDirection.Rotation());
+			EffectPool->SpawnEmitterAtLocation(Effect.Particles, Hit.ImpactPoint, ParticleDirection.Rotation());
 		}
 
 		if (Effect.Sound)
 		{
-			UGameplayStatics::SpawnSoundAtLocation(World, Effect.Sound, Hit.ImpactPoint, Rotation);
+			EffectPool->SpawnSoundAtLocation(Effect.Sound, Hit.ImpactPoint, Rotation);
 		}
 
 		if (Effect.Decal.Material)
@@ -37,8 +40,8 @@ void UAtomImpactEffect::SpawnEffect(UWorld* World, const FHitResult& Hit) const
 			const FRotator DecalRotation = Rotation;
 
 			// #bstodo Apply random rotation to decal
-			UGameplayStatics::SpawnDecalAttached(Effect.Decal.Material, Effect.Decal.DecalSize, Hit.Component.Get(), Hit.BoneName,
-				Hit.ImpactPoint, DecalRotation, EAttachLocation::KeepWorldPosition, Effect.Decal.LifeSpan);
+			EffectPool->SpawnDecalAttached(Effect.Decal.Material, Effect.Decal.DecalSize, Hit.Component.Get(), Hit.BoneName,
+				Hit.ImpactPoint, DecalRotation, Effect.Decal.LifeSpan);
 		}
 	}
 }
@@ -42,6 +42,16 @@ void UAmmoLoader::OnUnequipped()
 
 }
 
+void UAmmoLoader::OnPooled()
+{
+
+}
+
+void UAmmoLoader::OnUnpooled()
+{
+
+}
+
 void UAmmoLoader::ConsumeAmmo()
 {
 	--AmmoCount;
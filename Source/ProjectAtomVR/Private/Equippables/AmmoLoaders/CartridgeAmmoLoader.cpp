@@ -3,6 +3,13 @@
 #include "ProjectAtomVR.h"
 #include "CartridgeAmmoLoader.h"
 #include "AtomFirearm.h"
+#include "AtomEquippablePool.h"
+
+namespace
+{
+	// Seconds a loaded cartridge is kept before pooling, giving time to replicate the unequip
+	static constexpr float LoadedCartridgeLingerTime = 1.f;
+}
 
 UCartridgeAmmoLoader::UCartridgeAmmoLoader(const FObjectInitializer& ObjectInitializer /*= FObjectInitializer::Get()*/)
 	: Super(ObjectInitializer)
@@ -39,7 +46,18 @@ void UCartridgeAmmoLoader::LoadAmmo(UObject* LoadObject)
 		}		
 
 		Cartridge->SetActorHiddenInGame(true);
-		Cartridge->SetLifeSpan(1.f); // Give time to replicate unequip
+
+		if (GetFirearm()->HasAuthority())
+		{
+			if (AAtomEquippablePool* const EquippablePool = AAtomEquippablePool::Get(this))
+			{
+				EquippablePool->ReleaseEquippable(Cartridge, LoadedCartridgeLingerTime);
+			}
+			else
+			{
+				Cartridge->SetLifeSpan(LoadedCartridgeLingerTime);
+			}
+		}
 	}
 
 	ensure(AmmoCount < Capacity);
@@ -94,6 +112,16 @@ void UCartridgeAmmoLoader::InitializeLoader()
 	OnAmmoCountChanged.ExecuteIfBound();
 }
 
+void UCartridgeAmmoLoader::OnUnpooled()
+{
+	Super::OnUnpooled();
+
+	AmmoCount = Capacity;
+	LoadTrigger->bGenerateOverlapEvents = false;
+
+	OnAmmoCountChanged.ExecuteIfBound();
+}
+
 void UCartridgeAmmoLoader::OnHandEnteredReloadTrigger(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, 
 	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
@@ -4,6 +4,7 @@
 #include "MagazineAmmoLoader.h"
 #include "AtomFirearm.h"
 #include "FirearmMagazine.h"
+#include "AtomEquippablePool.h"
 
 namespace
 {
@@ -12,6 +13,9 @@ namespace
 	static constexpr float SmoothLoadSpeed = 30.f;
 	static constexpr float ClipAttachRotationErrorDegrees = 20.f;
 	static constexpr float ClipAttachRotationErrorRadians = ClipAttachRotationErrorDegrees * (PI / 180.f);
+
+	// Seconds a discarded magazine stays in the world before pooling
+	static constexpr float DiscardedMagazineLingerTime = 10.f;
 }
 
 UMagazineAmmoLoader::UMagazineAmmoLoader(const FObjectInitializer& ObjectInitializer /*= FObjectInitializer::Get()*/)
@@ -71,7 +75,18 @@ void UMagazineAmmoLoader::Destroy()
 
 	if (Magazine != nullptr)
 	{
-		Magazine->Destroy();
+		if (GetFirearm()->HasAuthority())
+		{
+			if (AAtomEquippablePool* const EquippablePool = AAtomEquippablePool::Get(this))
+			{
+				EquippablePool->ReleaseEquippable(Magazine, 0.f);
+			}
+			else
+			{
+				Magazine->Destroy();
+			}
+		}
+
 		Magazine = nullptr;
 	}
 
@@ -116,14 +131,9 @@ void UMagazineAmmoLoader::InitializeLoader()
 {
 	Super::InitializeLoader();
 
-	if (GetFirearm()->HasAuthority() && MagazineTemplate)
+	if (GetFirearm()->HasAuthority())
 	{
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.Owner = GetFirearm()->GetCharacterOwner();
-		
-		const FTransform Transform = GetFirearm()->GetMesh()->GetSocketTransform(MagazineAttachSocket); // Spawn at attach location
-		RemoteConnectionMagazine = GetWorld()->SpawnActor<AFirearmMagazine>(MagazineTemplate, Transform, SpawnParams);
-		LoadAmmo(RemoteConnectionMagazine);
+		LoadDefaultMagazine();
 	}
 
 	if (!GetFirearm()->IsTemplate())
@@ -132,6 +142,63 @@ void UMagazineAmmoLoader::InitializeLoader()
 	}
 }
 
+void UMagazineAmmoLoader::LoadDefaultMagazine()
+{
+	AAtomEquippablePool* const EquippablePool = AAtomEquippablePool::Get(this);
+	if (MagazineTemplate == nullptr || EquippablePool == nullptr)
+		return;
+
+	const FTransform Transform = GetFirearm()->GetMesh()->GetSocketTransform(MagazineAttachSocket); // Spawn at attach location
+	RemoteConnectionMagazine = EquippablePool->SpawnEquippable<AFirearmMagazine>(MagazineTemplate, Transform, GetFirearm()->GetCharacterOwner());
+	LoadAmmo(RemoteConnectionMagazine);
+}
+
+void UMagazineAmmoLoader::OnPooled()
+{
+	Super::OnPooled();
+
+	bIsLoadingMagazine = false;
+	ReloadTrigger->bGenerateOverlapEvents = false;
+
+	if (Magazine != nullptr)
+	{
+		// Attached magazines are not pooled with the firearm, only hidden
+		Magazine->SetActorHiddenInGame(true);
+	}
+}
+
+void UMagazineAmmoLoader::OnUnpooled()
+{
+	Super::OnUnpooled();
+
+	if (Magazine != nullptr)
+	{
+		if (GetFirearm()->HasAuthority())
+		{
+			Magazine->SetOwner(GetFirearm()->GetOwner());
+			Magazine->Instigator = GetFirearm()->Instigator;
+		}
+
+		Magazine->SetActorHiddenInGame(false);
+
+		// Finish any interrupted load
+		Magazine->GetMesh()->SetRelativeLocationAndRotation(FVector::ZeroVector, FQuat::Identity);
+		AmmoCount = Magazine->GetCapacity();
+
+		OnAmmoCountChanged.ExecuteIfBound();
+	}
+	else
+	{
+		// Discarded before pooling. The next magazine is attached immediately, as on a newly spawned firearm.
+		bHasInitialMagazine = false;
+
+		if (GetFirearm()->HasAuthority())
+		{
+			LoadDefaultMagazine();
+		}
+	}
+}
+
 bool UMagazineAmmoLoader::DiscardAmmo()
 {
 	if (!Magazine)
@@ -141,8 +208,8 @@ bool UMagazineAmmoLoader::DiscardAmmo()
 
 	Magazine->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform); 
 
-	Magazine->bTearOff = true;
-	Magazine->GetLoadTrigger()->bGenerateOverlapEvents = false; // Disable trigger on eject, pending destroy
+	// Every connection simulates the discard, so the magazine keeps replicating only to be pooled and reused
+	Magazine->GetLoadTrigger()->bGenerateOverlapEvents = false; // Disable trigger on eject, pending pooling
 
 	UMeshComponent* const MagazineMesh = Magazine->GetMesh();
 	MagazineMesh->SetCollisionProfileName(UCollisionProfile::BlockAllDynamic_ProfileName);
@@ -150,7 +217,17 @@ bool UMagazineAmmoLoader::DiscardAmmo()
 
 	MagazineMesh->SetSimulatePhysics(true);
 
-	Magazine->SetLifeSpan(10.f);
+	if (GetFirearm()->HasAuthority())
+	{
+		if (AAtomEquippablePool* const EquippablePool = AAtomEquippablePool::Get(this))
+		{
+			EquippablePool->ReleaseEquippable(Magazine, DiscardedMagazineLingerTime);
+		}
+		else
+		{
+			Magazine->SetLifeSpan(DiscardedMagazineLingerTime);
+		}
+	}
 
 	bIsLoadingMagazine = false;
 	Magazine = nullptr;
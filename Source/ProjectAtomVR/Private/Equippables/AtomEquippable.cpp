@@ -9,6 +9,8 @@
 #include "NetMotionControllerComponent.h"
 #include "GameFramework/PlayerController.h"
 #include "Engine/ActorChannel.h"
+#include "AtomEquippablePool.h"
+#include "AtomPlayerController.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogEquippable, Log, All);
 
@@ -16,6 +18,29 @@ namespace
 {
 	static const FName SecondaryHandAttachLeftSocket{ TEXT("SecondaryHandAttachLeft") };
 	static const FName SecondaryHandAttachRightSocket{ TEXT("SecondaryHandAttachRight") };
+
+	// Seconds a dropped equippable stays in the world before being pooled or destroyed
+	static constexpr float DroppedLingerTime = 10.f;
+}
+
+bool FEquippableStateStackRep::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	Ar << Version;
+	Ar << EquipCount;
+
+	uint32 NumStates = StateIndices.Num();
+	Ar.SerializeInt(NumStates, MaxStackDepth + 1);
+
+	if (Ar.IsLoading())
+	{
+		StateIndices.SetNumUninitialized(NumStates);
+	}
+
+	Ar.Serialize(StateIndices.GetData(), NumStates);
+
+	return true;
 }
 
 const FName AAtomEquippable::MeshComponentName = TEXT("Mesh");
@@ -81,12 +106,22 @@ void AAtomEquippable::Equip(const EHand Hand, const EEquipType EquipType)
 	
 	EquipStatus.Hand = Hand;
 	EquipStatus.State = EEquipState::Equipped;
+	StateStackVersion = 0;
+
+	++EquipCount;
+	if (HasAuthority())
+	{
+		ReplicatedEquipCount = EquipCount;
+	}
 	
 	if (CharacterOwner->IsLocallyControlled())
 	{
-		// Enable input if locally controlled.
-		EnableInput(CastChecked<APlayerController>(CharacterOwner->GetController()));
-		SetupInputComponent(InputComponent);
+		// Enable input if locally controlled by a player. AI controllers drive states directly.
+		if (APlayerController* const PlayerController = Cast<APlayerController>(CharacterOwner->GetController()))
+		{
+			EnableInput(PlayerController);
+			SetupInputComponent(InputComponent);
+		}
 	}
 
 	if (!bIsSimulatingReplication)
@@ -147,11 +182,10 @@ void AAtomEquippable::Unequip(const EEquipType EquipType)
 	ensure(StateStack.Top() == InactiveState);
 	StateStack.Top()->OnEnteredState();
 
-	if (CharacterOwner->IsLocallyControlled())
+	if (InputComponent)
 	{
 		// Disable input if locally controlled.
-		check(InputComponent);
-		DisableInput(CastChecked<APlayerController>(CharacterOwner->GetController()));
+		DisableInput(Cast<APlayerController>(CharacterOwner->GetController()));
 		InputComponent->DestroyComponent();
 		InputComponent = nullptr;
 	}
@@ -185,7 +219,22 @@ void AAtomEquippable::Drop()
 	SetActorEnableCollision(true);
 
 	Mesh->SetSimulatePhysics(true);
-	SetLifeSpan(10.f);
+
+	if (!CanBePooled())
+	{
+		SetLifeSpan(DroppedLingerTime);
+	}
+	else if (HasAuthority())
+	{
+		if (AAtomEquippablePool* const EquippablePool = AAtomEquippablePool::Get(this))
+		{
+			EquippablePool->ReleaseEquippable(this, DroppedLingerTime);
+		}
+		else
+		{
+			SetLifeSpan(DroppedLingerTime);
+		}
+	}
 }
 
 void AAtomEquippable::UpdateCharacterAttachment()
@@ -207,29 +256,16 @@ void AAtomEquippable::PushState(UEquippableState* InPushState)
 
 	UE_LOG(LogEquippable, Log, TEXT("Pushed State: %s"), *InPushState->GetName());
 
-	if (!CharacterOwner->HasAuthority() && CharacterOwner->IsLocallyControlled())
-	{
-		ServerPushState(InPushState);
-	}
-
 	UEquippableState* const LastState = StateStack.Top();
 	StateStack.Push(InPushState);
-	LastState->OnExitedState();
-	InPushState->OnStatePushed();
-}
 
-void AAtomEquippable::ServerPushState_Implementation(UEquippableState* State)
-{
-	// The server could already be in the requested state, so check first.
-	if (StateStack.Top() != State)
+	if (!CharacterOwner->HasAuthority() && CharacterOwner->IsLocallyControlled())
 	{
-		PushState(State);
+		SendStateStack();
 	}
-}
 
-bool AAtomEquippable::ServerPushState_Validate(UEquippableState* State)
-{
-	return true;
+	LastState->OnExitedState();
+	InPushState->OnStatePushed();
 }
 
 UEquippableState* AAtomEquippable::GetCurrentState() const
@@ -245,32 +281,107 @@ void AAtomEquippable::PopState(UEquippableState* InPopState)
 
 	UE_LOG(LogEquippable, Log, TEXT("Popped State: %s"), *InPopState->GetName());
 
+	UEquippableState* PoppedState = StateStack.Pop(false); // no need to shrink, it'll probably be added again
+
 	if (!CharacterOwner->HasAuthority() && CharacterOwner->IsLocallyControlled())
 	{
-		ServerPopState(InPopState);
+		SendStateStack();
 	}
 
-	UEquippableState* PoppedState = StateStack.Pop(false); // no need to shrink, it'll probably be added again
 	PoppedState->OnStatePopped();
 	StateStack.Top()->OnEnteredState();
 }
 
-void AAtomEquippable::ServerPopState_Implementation(UEquippableState* InPopState)
+void AAtomEquippable::SendStateStack()
 {
-	// The server could already be in the requested state, so check first.
-	if (StateStack.Top() == InPopState)
+	FEquippableStateStackRep StackRep;
+	StackRep.Version = ++StateStackVersion;
+	StackRep.EquipCount = EquipCount;
+
+	for (const UEquippableState* State : StateStack)
 	{
-		PopState(InPopState);
+		StackRep.StateIndices.Add(GetStateIndex(State));
 	}
+
+	ServerSetStateStack(StackRep);
 }
 
-bool AAtomEquippable::ServerPopState_Validate(UEquippableState* InPopState)
+uint8 AAtomEquippable::GetStateIndex(const UEquippableState* State) const
 {
+	const int32 Index = EquippableStates.IndexOfByKey(State);
+	check(Index != INDEX_NONE);
+
+	return static_cast<uint8>(Index);
+}
+
+void AAtomEquippable::ServerSetStateStack_Implementation(const FEquippableStateStackRep& StackRep)
+{
+	// Stacks sent before the server's last equip are stale. Versions restart on equip, so they are only
+	// compared within the same equip.
+	const int8 EquipDelta = static_cast<int8>(StackRep.EquipCount - EquipCount);
+	if (EquipDelta < 0 || (EquipDelta == 0 && static_cast<int8>(StackRep.Version - StateStackVersion) <= 0))
+		return;
+
+	StateStackVersion = StackRep.Version;
+
+	if (StateStack.Num() == 0 || GetStateIndex(StateStack[0]) != StackRep.StateIndices[0])
+	{
+		AAtomPlayerController::RejectServerRpc(this, EServerRpcFamily::Equip, TEXT("State stack with a different base state"));
+		return;
+	}
+
+	// The server could already be in some of the requested states, so only pop and push above the shared base.
+	int32 NumShared = 1;
+	while (NumShared < StateStack.Num() && NumShared < StackRep.StateIndices.Num() &&
+		GetStateIndex(StateStack[NumShared]) == StackRep.StateIndices[NumShared])
+	{
+		++NumShared;
+	}
+
+	while (StateStack.Num() > NumShared)
+	{
+		PopState(StateStack.Top());
+	}
+
+	for (int32 i = NumShared; i < StackRep.StateIndices.Num(); ++i)
+	{
+		UEquippableState* const State = EquippableStates[StackRep.StateIndices[i]];
+		if (StateStack.Find(State) == INDEX_NONE)
+		{
+			PushState(State);
+		}
+	}
+}
+
+bool AAtomEquippable::ServerSetStateStack_Validate(const FEquippableStateStackRep& StackRep)
+{
+	if (StackRep.StateIndices.Num() == 0)
+		return false;
+
+	for (int32 i = 0; i < StackRep.StateIndices.Num(); ++i)
+	{
+		if (StackRep.StateIndices[i] >= EquippableStates.Num())
+			return false;
+
+		// States can only be on the stack once
+		for (int32 j = 0; j < i; ++j)
+		{
+			if (StackRep.StateIndices[j] == StackRep.StateIndices[i])
+				return false;
+		}
+	}
+
 	return true;
 }
 
 void AAtomEquippable::ServerDrop_Implementation()
 {
+	if (!IsEquipped())
+	{
+		AAtomPlayerController::RejectServerRpc(this, EServerRpcFamily::Equip, TEXT("Dropped an item that is not equipped"));
+		return;
+	}
+
 	Drop();
 }
 
@@ -294,7 +405,15 @@ void AAtomEquippable::OnRep_EquipStatus()
 		}
 		else if (ReplicatedEquipStatus.State == EEquipState::Unequipped)
 		{
-			Unequip();
+			if (EquipStatus.State == EEquipState::Equipped)
+			{
+				Unequip();
+			}
+			else
+			{
+				// Dropped items reused from the pool go straight back to unequipped
+				EquipStatus.State = EEquipState::Unequipped;
+			}
 		}
 		else
 		{
@@ -305,6 +424,15 @@ void AAtomEquippable::OnRep_EquipStatus()
 	}
 }
 
+void AAtomEquippable::OnRep_EquipCount()
+{
+	// Only catch up on equips forced by the server, the client's own equips are already counted
+	if (static_cast<int8>(ReplicatedEquipCount - EquipCount) > 0)
+	{
+		EquipCount = ReplicatedEquipCount;
+	}
+}
+
 void AAtomEquippable::OnRep_Owner()
 {
 	Super::OnRep_Owner();
@@ -377,6 +505,85 @@ ELoadoutType AAtomEquippable::GetLoadoutType() const
 	return LoadoutType;
 }
 
+void AAtomEquippable::ReturnToPool()
+{
+	check(HasAuthority());
+	ensure(!IsEquipped());
+
+	if (!IsPooled())
+	{
+		++PoolCounter;
+		OnPooled();
+	}
+}
+
+void AAtomEquippable::ReuseFromPool(AAtomCharacter* NewOwner)
+{
+	check(HasAuthority());
+
+	if (IsPooled())
+	{
+		++PoolCounter;
+	}
+
+	SetOwner(NewOwner);
+	Instigator = NewOwner;
+
+	EquipStatus.State = EEquipState::Unequipped;
+	ReplicatedEquipStatus = EquipStatus;
+
+	OnUnpooled();
+}
+
+bool AAtomEquippable::CanBePooled() const
+{
+	return !IsEquipped();
+}
+
+void AAtomEquippable::OnPooled()
+{
+	DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+
+	Mesh->SetSimulatePhysics(false);
+	SetActorEnableCollision(false);
+	SetActorHiddenInGame(true);
+}
+
+void AAtomEquippable::OnUnpooled()
+{
+	// Undo drops and discards, which enable physics and collision on the mesh
+	const AAtomEquippable* const DefaultEquippable = GetClass()->GetDefaultObject<AAtomEquippable>();
+
+	Mesh->SetSimulatePhysics(false);
+	Mesh->SetCollisionProfileName(DefaultEquippable->Mesh->GetCollisionProfileName());
+	SetActorEnableCollision(DefaultEquippable->GetActorEnableCollision());
+	SetActorHiddenInGame(DefaultEquippable->bHidden);
+
+	UnequipTimeStamp = 0.f;
+}
+
+bool AAtomEquippable::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+{
+	// Pooled equippables are hidden without collision, which would close their channels. Keep them relevant
+	// so reuse replicates as a property update instead of respawning on every client.
+	if (IsPooled())
+		return true;
+
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+}
+
+void AAtomEquippable::OnRep_PoolCounter()
+{
+	if (IsPooled())
+	{
+		OnPooled();
+	}
+	else
+	{
+		OnUnpooled();
+	}
+}
+
 void AAtomEquippable::SetupInputComponent(UInputComponent* InInputComponent)
 {
 	check(InInputComponent);
@@ -434,6 +641,13 @@ void AAtomEquippable::OnEndOverlapSecondaryHandTrigger(UPrimitiveComponent* Over
 
 void AAtomEquippable::ServerEquip_Implementation(const EHand Hand)
 {
+	// Equip expects only the inactive state on the stack
+	if (IsEquipped() || StateStack.Num() != 1)
+	{
+		AAtomPlayerController::RejectServerRpc(this, EServerRpcFamily::Equip, TEXT("Equipped an item that is already equipped"));
+		return;
+	}
+
 	Equip(Hand);
 }
 
@@ -444,6 +658,12 @@ bool AAtomEquippable::ServerEquip_Validate(const EHand Hand)
 
 void AAtomEquippable::ServerUnequip_Implementation()
 {
+	if (!IsEquipped())
+	{
+		AAtomPlayerController::RejectServerRpc(this, EServerRpcFamily::Equip, TEXT("Unequipped an item that is not equipped"));
+		return;
+	}
+
 	Unequip();
 }
 
@@ -465,14 +685,31 @@ void AAtomEquippable::PostInitializeComponents()
 {
 	Super::PostInitializeComponents();
 
-	// Gather all states
-	TArray<UObject*> Subobjects;
-	GetObjectsWithOuter(this, Subobjects, false);
-	for (UObject* Subobject : Subobjects)
+	// Gather all states in property order, which is the same on every connection
+	for (TFieldIterator<UObjectProperty> It{ GetClass() }; It; ++It)
+	{
+		if (It->PropertyClass->IsChildOf(UEquippableState::StaticClass()))
+		{
+			UEquippableState* const State = Cast<UEquippableState>(It->GetObjectPropertyValue_InContainer(this));
+			if (State && State->GetOuter() == this)
+			{
+				EquippableStates.AddUnique(State);
+			}
+		}
+	}
+
+	check(EquippableStates.Num() <= MAX_uint8);
+
+	// States without replicated properties are only referenced by index and never need a channel
+	for (UEquippableState* State : EquippableStates)
 	{
-		if (UEquippableState* State = Cast<UEquippableState>(Subobject))
+		for (TFieldIterator<UProperty> It{ State->GetClass() }; It; ++It)
 		{
-			EquippableStates.Push(State);
+			if (It->HasAnyPropertyFlags(CPF_Net))
+			{
+				ReplicatedStates.Add(State);
+				break;
+			}
 		}
 	}
 
@@ -484,6 +721,8 @@ void AAtomEquippable::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutL
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
 	DOREPLIFETIME_CONDITION(AAtomEquippable, ReplicatedEquipStatus, COND_SkipOwner);
+	DOREPLIFETIME_CONDITION(AAtomEquippable, ReplicatedEquipCount, COND_OwnerOnly);
+	DOREPLIFETIME(AAtomEquippable, PoolCounter);
 }
 
 void AAtomEquippable::PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker)
@@ -510,8 +749,7 @@ bool AAtomEquippable::ReplicateSubobjects(class UActorChannel *Channel, class FO
 {
 	bool WroteSomething = Super::ReplicateSubobjects(Channel, Bunch, RepFlags);;
 
-	// All states are required to replicate
-	for (UObject* State : EquippableStates)
+	for (UObject* State : ReplicatedStates)
 	{
 		WroteSomething |= Channel->ReplicateSubobject(State, *Bunch, *RepFlags);	
 	}
@@ -523,16 +761,13 @@ void AAtomEquippable::GetSubobjectsWithStableNamesForNetworking(TArray<UObject*>
 {
 	Super::GetSubobjectsWithStableNamesForNetworking(ObjList);
 
-	// For experimenting with replicating ALL stably named components initially
-	for (UEquippableState* State : EquippableStates)
+	// Replicated states are added in index order, which already matches on server and clients
+	for (UEquippableState* State : ReplicatedStates)
 	{		
-		if (State && State->IsNameStableForNetworking())
+		if (State->IsNameStableForNetworking())
 		{
 			ObjList.Add(State);
 			State->GetSubobjectsWithStableNamesForNetworking(ObjList);
 		}
 	}
-
-	// Sort to keep lists consistent on server and clients
-	Sort(ObjList.GetData(), ObjList.Num(), [](const UObject& A, const UObject& B) {return A.GetName() < B.GetName(); });
 }
\ No newline at end of file
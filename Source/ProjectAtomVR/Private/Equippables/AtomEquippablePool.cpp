@@ -0,0 +1,147 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#include "ProjectAtomVR.h"
+#include "AtomEquippablePool.h"
+
+#include "AtomEquippable.h"
+#include "AtomWorldPool.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogEquippablePool, Log, All);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Equippable Pool Reuses"), STAT_EquippablePoolReuses, STATGROUP_ProjectAtom);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Equippable Pool Spawns"), STAT_EquippablePoolSpawns, STATGROUP_ProjectAtom);
+
+namespace
+{
+	// Seconds between checks for equippables done lingering
+	constexpr float LingerCheckInterval = 0.25f;
+}
+
+static FAutoConsoleCommandWithWorld DumpEquippablePoolCommand(
+	TEXT("s.DumpEquippablePool"),
+	TEXT("Logs equippable pool sizes and reuse counts"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (AAtomEquippablePool* const EquippablePool = TAtomWorldPool<AAtomEquippablePool>::Find(World))
+		{
+			EquippablePool->DumpStats();
+		}
+	}));
+
+AAtomEquippablePool::AAtomEquippablePool(const FObjectInitializer& ObjectInitializer /*= FObjectInitializer::Get()*/)
+	: Super(ObjectInitializer)
+{
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.TickInterval = LingerCheckInterval;
+
+	bReplicates = false;
+}
+
+AAtomEquippablePool* AAtomEquippablePool::Get(const UObject* WorldContextObject)
+{
+	return TAtomWorldPool<AAtomEquippablePool>::Get(WorldContextObject, TEXT("EquippablePool"));
+}
+
+void AAtomEquippablePool::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	TAtomWorldPool<AAtomEquippablePool>::Register(this);
+}
+
+void AAtomEquippablePool::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	TAtomWorldPool<AAtomEquippablePool>::Unregister(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AAtomEquippablePool::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	LingeringEquippables.RemoveExpired(GetWorld()->GetTimeSeconds(), [this](AAtomEquippable* Equippable) { PoolEquippable(Equippable); });
+}
+
+AAtomEquippable* AAtomEquippablePool::SpawnEquippable(TSubclassOf<AAtomEquippable> EquippableClass, const FTransform& Transform, AAtomCharacter* Owner)
+{
+	if (EquippableClass == nullptr)
+		return nullptr;
+
+	check(GetNetMode() != NM_Client);
+
+	if (TArray<TWeakObjectPtr<AAtomEquippable>>* const Pooled = PooledEquippables.Find(*EquippableClass))
+	{
+		while (Pooled->Num() > 0)
+		{
+			AAtomEquippable* const Equippable = Pooled->Pop(false).Get();
+			if (Equippable && !Equippable->IsPendingKillPending())
+			{
+				++NumReused;
+				INC_DWORD_STAT(STAT_EquippablePoolReuses);
+
+				Equippable->SetActorTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+				Equippable->ReuseFromPool(Owner);
+				return Equippable;
+			}
+		}
+	}
+
+	++NumSpawned;
+	INC_DWORD_STAT(STAT_EquippablePoolSpawns);
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Instigator = Owner;
+	SpawnParams.Owner = Owner;
+
+	return GetWorld()->SpawnActor<AAtomEquippable>(EquippableClass, Transform, SpawnParams);
+}
+
+void AAtomEquippablePool::ReleaseEquippable(AAtomEquippable* Equippable, float LingerTime)
+{
+	if (Equippable == nullptr || Equippable->IsPooled())
+		return;
+
+	check(GetNetMode() != NM_Client);
+
+	if (LingerTime > 0.f)
+	{
+		LingeringEquippables.Add(Equippable, GetWorld()->GetTimeSeconds() + LingerTime);
+	}
+	else
+	{
+		PoolEquippable(Equippable);
+	}
+}
+
+void AAtomEquippablePool::PoolEquippable(AAtomEquippable* Equippable)
+{
+	if (Equippable->IsPendingKillPending())
+		return;
+
+	TArray<TWeakObjectPtr<AAtomEquippable>>& Pooled = PooledEquippables.FindOrAdd(Equippable->GetClass());
+
+	// Drop any pooled equippables destroyed elsewhere, i.e. by their loader
+	Pooled.RemoveAllSwap([](const TWeakObjectPtr<AAtomEquippable>& PooledEquippable) { return !PooledEquippable.IsValid(); }, false);
+
+	if (Pooled.Num() >= MaxPooledPerClass)
+	{
+		++NumDestroyed;
+		Equippable->Destroy();
+		return;
+	}
+
+	Equippable->ReturnToPool();
+	Pooled.Add(Equippable);
+}
+
+void AAtomEquippablePool::DumpStats() const
+{
+	for (const auto& Pair : PooledEquippables)
+	{
+		UE_LOG(LogEquippablePool, Log, TEXT("%s: %d/%d pooled"), *GetNameSafe(Pair.Key), Pair.Value.Num(), MaxPooledPerClass);
+	}
+
+	UE_LOG(LogEquippablePool, Log, TEXT("%d lingering, %u reused, %u spawned, %u destroyed"),
+		LingeringEquippables.Num(), NumReused, NumSpawned, NumDestroyed);
+}
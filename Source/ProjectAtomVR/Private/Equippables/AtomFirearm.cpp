@@ -13,8 +13,11 @@
 #include "EquippableStateFiring.h"
 #include "MagazineAmmoLoader.h"
 #include "Engine/ActorChannel.h"
-
-DEFINE_LOG_CATEGORY_STATIC(LogFirearm, Log, All);
+#include "Effects/AtomEffectPool.h"
+#include "FirearmBenchmark.h"
+#include "FirearmDiagnostics.h"
+#include "IConsoleManager.h"
+#include "AtomPlayerController.h"
 
 #define LOCTEXT_NAMESPACE "Firearm" 
 
@@ -48,6 +51,15 @@ namespace
 
 	// Seconds before help indicators are displayed.
 	constexpr float HelpIndicatorDelay = 5.f;
+
+	// Server allowance over the fire rate for shots bunched up by network jitter.
+	constexpr float ServerFireRateTolerance = 1.1f;
+
+	static TAutoConsoleVariable<float> CVarShotBatchInterval(
+		TEXT("s.ShotBatchInterval"),
+		0.1f,
+		TEXT("Min seconds between shot RPCs sent by a client. Shots fired in between are batched into the next RPC."),
+		ECVF_Default);
 }
 
 AAtomFirearm::AAtomFirearm(const FObjectInitializer& ObjectInitializer /*= FObjectInitializer::Get()*/)
@@ -71,6 +83,7 @@ AAtomFirearm::AAtomFirearm(const FObjectInitializer& ObjectInitializer /*= FObje
 	RecoilVelocity.Directional = FVector::ZeroVector;
 	RecoilVelocity.Angular = FVector::ZeroVector;
 	bIsRecoilActive = false;
+	bIsMuzzleInGeometry = false;
 
 	ChamberingHandleRadius = 10.f;
 	bIsChamberEmpty = false;
@@ -101,11 +114,17 @@ void AAtomFirearm::Tick( float DeltaTime )
 	{
 		UpdateRecoilOffset(DeltaTime);
 	}
-	
+
+	if (PendingShots.Shots.Num() > 0 && GetWorld()->GetTimeSeconds() - LastShotBatchTime >= GetShotBatchInterval())
+	{
+		FlushPendingShots();
+	}
 }
 
 void AAtomFirearm::UpdateChamberingHandle()
 {
+	FScopedFirearmBenchmarkTimer BenchmarkTimer{ EFirearmBenchmarkTimer::UpdateChamberingHandle };
+
 	if (bIsHoldingChamberHandle)
 	{
 		if (CanGripChamberingHandle())
@@ -183,7 +202,9 @@ void AAtomFirearm::UpdateChamberingHandle()
 
 void AAtomFirearm::UpdateRecoilOffset(float DeltaSeconds)
 {
-	UE_LOG(LogFirearm, Log, TEXT("Updating recoil offset for firearm."));
+	FScopedFirearmBenchmarkTimer BenchmarkTimer{ EFirearmBenchmarkTimer::UpdateRecoilOffset };
+
+	FIREARM_LOG(Recoil, Verbose, TEXT("Updating recoil offset for %s"), *GetName());
 
 	USceneComponent* MyMesh = GetMesh();
 	USceneComponent* OffsetTarget = GetOffsetTarget();
@@ -277,8 +298,21 @@ bool AAtomFirearm::CanFire() const
 		!IsMuzzleInGeometry();
 }
 
+float AAtomFirearm::GetShotBatchInterval()
+{
+	return CVarShotBatchInterval.GetValueOnGameThread();
+}
+
 bool AAtomFirearm::IsMuzzleInGeometry() const
 {
+	// Firing states check each shot and trigger press, the muzzle only needs testing once a frame
+	if (MuzzleTestFrame == GFrameCounter)
+	{
+		return bIsMuzzleInGeometry;
+	}
+
+	MuzzleTestFrame = GFrameCounter;
+
 	const FCollisionObjectQueryParams ObjectParams{ FCollisionObjectQueryParams::AllStaticObjects };
 	const FCollisionQueryParams QueryParams( NAME_None, false, this );
 
@@ -289,7 +323,9 @@ bool AAtomFirearm::IsMuzzleInGeometry() const
 	// WorldRotation, FColor::Blue, false, 1.f, 0, .2f);
 
 	const FCollisionShape MuzzleCollision = FCollisionShape::MakeCapsule(BlockFireVolume.CapsuleRadius, BlockFireVolume.CapsuleHalfHeight);
-	return GetWorld()->OverlapAnyTestByObjectType(WorldLocation, WorldRotation, ObjectParams, MuzzleCollision, QueryParams);
+	bIsMuzzleInGeometry = GetWorld()->OverlapAnyTestByObjectType(WorldLocation, WorldRotation, ObjectParams, MuzzleCollision, QueryParams);
+
+	return bIsMuzzleInGeometry;
 }
 
 void AAtomFirearm::LoadAmmo(UObject* LoadObject, bool bForceLocalOnly)
@@ -342,8 +378,28 @@ void AAtomFirearm::DiscardAmmo()
 	}
 }
 
+void AAtomFirearm::ChamberRound()
+{
+	if (bIsSlideLockActive)
+	{
+		OnSlideLockPressed();
+	}
+	else
+	{
+		ReloadChamber(false);
+	}
+}
+
 void AAtomFirearm::ServerLoadAmmo_Implementation(UObject* LoadObject)
 {
+	// Only ammo owned by the same character can be loaded
+	const AAtomEquippable* const LoadEquippable = Cast<AAtomEquippable>(LoadObject);
+	if (LoadEquippable && (LoadEquippable->GetCharacterOwner() != GetCharacterOwner() || LoadEquippable->IsPooled()))
+	{
+		AAtomPlayerController::RejectServerRpc(this, EServerRpcFamily::Ammo, TEXT("Loaded ammo owned by another character"));
+		return;
+	}
+
 	LoadAmmo(LoadObject);
 }
 
@@ -364,20 +420,25 @@ bool AAtomFirearm::ServerDiscardAmmo_Validate()
 
 void AAtomFirearm::FireShot()
 {
+	FScopedFirearmBenchmarkTimer BenchmarkTimer{ EFirearmBenchmarkTimer::FireShot };
+
 	check(ShotType);
 
-	UE_LOG(LogFirearm, Log, TEXT("FireShot by %s"), HasAuthority() ? TEXT("Authority") : TEXT("Client"));
+	FFirearmDiagnostics::Trace(EFirearmTraceCategory::Fire, this, TEXT("FireShot"), ShotSequence, AmmoLoader->GetAmmoCount());
 
 	// Since the firing state will be call FireShot while active, it will be
 	// call by Autonomous, Authority, and Simulated connections. We will allow simulated
 	// proxies to simulate fire. Autonomous will simulate and call ServerFire. Authority
 	// will only fire here if it is locally controlled. Otherwise, it will wait on the controlling
-	// client to sent a fire event through ServerFireShot.
+	// client to sent a fire event through ServerFireShotBatch.
 	if (GetCharacterOwner()->IsLocallyControlled())
 	{
 		// Get shot data before applying recoil
-		const FShotData ShotData = ShotType->GetShotData();
-		GenerateShotRecoil(ShotData.Seed);
+		FShotData ShotData = ShotType->GetShotData();
+		ShotData.Seed = ShotSequence++;
+
+		ResetShotRandomStream(ShotData.Seed);
+		GenerateShotRecoil();
 
 		// Play effects and reload chamber before firing the shot. This keeps situations such as killing yourself in order.
 		// i.e. FireShot -> Die -> Drop Firearm -> Pop FiringState (which calls StopFiringSequence)
@@ -391,14 +452,17 @@ void AAtomFirearm::FireShot()
 		else
 		{
 			ShotType->SimulateShot(ShotData);
-			ServerFireShot(ShotData);
+			QueueShot(ShotData);
 		}
 	}
 	else if(Role == ENetRole::ROLE_SimulatedProxy)
 	{
 		// Get shot data before applying recoil
-		const FShotData ShotData = ShotType->GetShotData();
-		GenerateShotRecoil(ShotData.Seed);
+		FShotData ShotData = ShotType->GetShotData();
+		ShotData.Seed = ShotSequence++;
+
+		ResetShotRandomStream(ShotData.Seed);
+		GenerateShotRecoil();
 
 		// See above comment for operation ordering
 		PlaySingleShotSequence();
@@ -416,41 +480,141 @@ void AAtomFirearm::DryFire()
 	}	
 }
 
-void AAtomFirearm::ServerFireShot_Implementation(FShotData ShotData)
+void AAtomFirearm::QueueShot(const FShotData& ShotData)
 {
-	UE_LOG(LogFirearm, Log, TEXT("ServerFireShot"));
-	GenerateShotRecoil(ShotData.Seed);
-	ShotType->FireShot(ShotData);
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
 
-	if (GetNetMode() != ENetMode::NM_DedicatedServer)
+	PendingShots.Shots.Add(ShotData);
+	PendingShotTimes.Add(CurrentTime);
+
+	// The first shot after a quiet period is sent right away so single shots are not delayed. Shots fired
+	// faster than the batch interval are held until Tick, StopFiringSequence, or the batch fills up.
+	if (PendingShots.Shots.Num() == FShotBatch::MaxShots || CurrentTime - LastShotBatchTime >= GetShotBatchInterval())
 	{
-		PlaySingleShotSequence();
+		FlushPendingShots();
 	}
+}
 
-	ReloadChamber(true);
+void AAtomFirearm::FlushPendingShots()
+{
+	if (PendingShots.Shots.Num() == 0)
+		return;
+
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
+
+	// Held shots are rewound further on the server to make up for the time spent in the batch
+	for (int32 i = 0; i < PendingShots.Shots.Num(); ++i)
+	{
+		PendingShots.Shots[i].BatchDelay = CurrentTime - PendingShotTimes[i];
+	}
+
+	ServerFireShotBatch(PendingShots);
+
+	PendingShots.Shots.Reset();
+	PendingShotTimes.Reset();
+	LastShotBatchTime = CurrentTime;
 }
 
-bool AAtomFirearm::ServerFireShot_Validate(FShotData ShotData)
+void AAtomFirearm::ServerFireShotBatch_Implementation(const FShotBatch& ShotBatch)
 {
-	return true;
+	FFirearmDiagnostics::Trace(EFirearmTraceCategory::Network, this, TEXT("ServerFireShotBatch"), ShotBatch.Shots.Num(), ShotBatch.Shots[0].Seed);
+
+	// Every sent shot used a sequence on the client, replayed or not
+	const uint8 FirstSequence = ShotSequence;
+	ShotSequence += ShotBatch.Shots.Num();
+
+	if (!AAtomPlayerController::AllowServerRpc(this, EServerRpcFamily::Fire))
+		return;
+
+	// The client seed only matches shots up. Spread and recoil come from the server sequence.
+	if (ShotBatch.Shots[0].Seed != FirstSequence)
+	{
+		AAtomPlayerController::RejectServerRpc(this, EServerRpcFamily::Fire, TEXT("Shot sequence mismatch"));
+		return;
+	}
+
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
+	const float FireRate = FMath::Max(Stats.FireRate, KINDA_SMALL_NUMBER);
+	const float ShotsPerSecond = ServerFireRateTolerance / FireRate;
+
+	// A legitimate batch holds the shots fired over one batch interval plus the shot that started it
+	const int32 MaxBurst = FMath::Min(FMath::CeilToInt(GetShotBatchInterval() / FireRate) + 1, static_cast<int32>(FShotBatch::MaxShots));
+
+	// Replay in the order the client fired so recoil and chamber state follow the same sequence
+	for (int32 i = 0; i < ShotBatch.Shots.Num(); ++i)
+	{
+		const FShotData& ShotData = ShotBatch.Shots[i];
+
+		// The authoritative chamber and fire rate decide if the shot happened, remaining shots in the batch are dropped
+		if (!IsEquipped() || bIsChamberEmpty)
+		{
+			AAtomPlayerController::RejectServerRpc(this, EServerRpcFamily::Fire, TEXT("Fired without ammo"));
+			break;
+		}
+
+		if (!ServerShotBudget.TryConsume(CurrentTime, ShotsPerSecond, MaxBurst))
+		{
+			AAtomPlayerController::RejectServerRpc(this, EServerRpcFamily::Fire, TEXT("Fired faster than the fire rate"));
+			break;
+		}
+
+		ResetShotRandomStream(static_cast<uint8>(FirstSequence + i));
+		GenerateShotRecoil();
+		ShotType->FireShot(ShotData);
+
+		if (GetNetMode() != ENetMode::NM_DedicatedServer)
+		{
+			PlaySingleShotSequence();
+		}
+
+		ReloadChamber(true);
+	}
+}
+
+bool AAtomFirearm::ServerFireShotBatch_Validate(const FShotBatch& ShotBatch)
+{
+	return ShotBatch.Shots.Num() > 0 && ShotBatch.Shots.Num() <= FShotBatch::MaxShots;
 }
 
 void AAtomFirearm::PlaySingleShotSequence()
 {
-	// Activate if not active or not looping
-	if (MuzzleFX != nullptr && (MuzzleFXComponent == nullptr || !MuzzleFX->IsLooping()))
+	// Single shot effects come from the effect pool. Looping effects are owned by the firearm until the firing sequence stops.
+	// The pool is only missing while the world is torn down, so its effects are skipped.
+	AAtomEffectPool* const EffectPool = AAtomEffectPool::Get(this);
+
+	if (MuzzleFX != nullptr)
 	{
-		MuzzleFXComponent = UGameplayStatics::SpawnEmitterAttached(MuzzleFX, GetMesh(), MuzzleSocket);
-		MuzzleFXComponent->ActivateSystem();
+		if (!MuzzleFX->IsLooping())
+		{
+			if (EffectPool)
+			{
+				EffectPool->SpawnEmitterAttached(MuzzleFX, GetMesh(), MuzzleSocket);
+			}
+		}
+		else if (MuzzleFXComponent == nullptr)
+		{
+			MuzzleFXComponent = UGameplayStatics::SpawnEmitterAttached(MuzzleFX, GetMesh(), MuzzleSocket);
+			MuzzleFXComponent->ActivateSystem();
+		}
 	}
 
 	CartridgeMeshComponent->SetVisibility(true);
 	CartridgeMeshComponent->SetStaticMesh(CartridgeFiredMesh);
 
-	if (FireSound && (!FireSound->IsLooping() || !FireSoundComponent))
+	if (FireSound != nullptr)
 	{
-		FireSoundComponent = UGameplayStatics::SpawnSoundAttached(FireSound, GetMesh(), MuzzleSocket);
-		FireSoundComponent->Play();
+		if (!FireSound->IsLooping())
+		{
+			if (EffectPool)
+			{
+				EffectPool->SpawnSoundAttached(FireSound, GetMesh(), MuzzleSocket);
+			}
+		}
+		else if (FireSoundComponent == nullptr)
+		{
+			FireSoundComponent = UGameplayStatics::SpawnSoundAttached(FireSound, GetMesh(), MuzzleSocket);
+			FireSoundComponent->Play();
+		}
 	}
 
 	if (FiringMontage)
@@ -574,12 +738,16 @@ void AAtomFirearm::ReleaseSlideLock()
 	ReloadChamber(false);
 }
 
-void AAtomFirearm::GenerateShotRecoil(uint8 Seed)
+void AAtomFirearm::ResetShotRandomStream(uint8 Seed)
+{
+	ShotRandomStream.Initialize(static_cast<int32>(HashCombine(static_cast<uint32>(ShotRandomSeed), Seed)));
+}
+
+void AAtomFirearm::GenerateShotRecoil()
 {
 	// Get random rotation [-1, 1] to factor in with RecoilPushSpread and
 	// apply the rotation to RecoilPush
-	FMath::RandInit(Seed);
-	const float Rotation = FMath::FRandRange(-1.f, 1.f) * Stats.RecoilPushSpread;
+	const float Rotation = ShotRandomStream.FRandRange(-1.f, 1.f) * Stats.RecoilPushSpread;
 	const FVector2D RecoilInput = Stats.RecoilRotationalPush.GetRotated(Rotation);
 	
 	// Apply recoil impulses
@@ -590,7 +758,7 @@ void AAtomFirearm::GenerateShotRecoil(uint8 Seed)
 	}
 
 	RecoilVelocity.Directional = FVector{ Stats.RecoilDirectionalPush.X, 0.f, Stats.RecoilDirectionalPush.Y };
-	RecoilVelocity.Directional *= FMath::FRandRange(0.5f, 1.f);
+	RecoilVelocity.Directional *= ShotRandomStream.FRandRange(0.5f, 1.f);
 
 	bIsRecoilActive = true;
 }
@@ -602,7 +770,9 @@ void AAtomFirearm::ShowHelp(EHelpIndicatorType Type, const float Lifetime)
 		return;
 
 	check(GetCharacterOwner()->IsLocallyControlled());
-	auto PlayerController = static_cast<AAtomPlayerController*>(GetCharacterOwner()->GetController());	
+	auto PlayerController = Cast<AAtomPlayerController>(GetCharacterOwner()->GetController());
+	if (PlayerController == nullptr)
+		return; // Help is only shown to players
 
 	switch (Type)
 	{
@@ -629,13 +799,17 @@ void AAtomFirearm::ClearHelp(EHelpIndicatorType Type)
 
 	if (HelpHandles[HandleIndex].IsValid())
 	{
-		auto PlayerController = CastChecked<AAtomPlayerController>(GetCharacterOwner()->GetController());
-		PlayerController->ClearHelpIndicator(HelpHandles[HandleIndex]);
+		if (auto PlayerController = Cast<AAtomPlayerController>(GetCharacterOwner()->GetController()))
+		{
+			PlayerController->ClearHelpIndicator(HelpHandles[HandleIndex]);
+		}
 	}	
 }
 
 void AAtomFirearm::ReloadChamber(bool bIsFired)
 {
+	FScopedFirearmBenchmarkTimer BenchmarkTimer{ EFirearmBenchmarkTimer::ReloadChamber };
+
 	// Eject first if not empty
 	if (!bIsChamberEmpty && CartridgeEjectComponent)
 	{
@@ -677,14 +851,16 @@ void AAtomFirearm::ReloadChamber(bool bIsFired)
 		CartridgeMeshComponent->SetStaticMesh(CartridgeUnfiredMesh);
 	}	
 
-	UE_LOG(LogFirearm, Log, TEXT("ReloadChamber by %s with IsChamberEmpty = %d and ammo count = %d"), 
-		HasAuthority() ? TEXT("Authority") : TEXT("Client"), bIsChamberEmpty, AmmoLoader->GetAmmoCount());
+	FFirearmDiagnostics::Trace(EFirearmTraceCategory::Reload, this, TEXT("ReloadChamber"), bIsChamberEmpty, AmmoLoader->GetAmmoCount());
 }
 
 void AAtomFirearm::OnEjectedCartridgeCollide(FName EventName, float EmitterTime, int32 ParticleTime, FVector Location, 
 	FVector Velocity, FVector Direction, FVector Normal, FName BoneName, UPhysicalMaterial* PhysMat)
 {
-	UGameplayStatics::SpawnSoundAtLocation(GetWorld(), CartridgeCollideSound, Location);
+	if (AAtomEffectPool* const EffectPool = AAtomEffectPool::Get(this))
+	{
+		EffectPool->SpawnSoundAtLocation(CartridgeCollideSound, Location);
+	}
 }
 
 void AAtomFirearm::OnRep_IsHoldingChamberHandle()
@@ -775,6 +951,7 @@ void AAtomFirearm::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLife
 	DOREPLIFETIME_CONDITION(AAtomFirearm, bIsHoldingChamberHandle, COND_SkipOwner);
 	DOREPLIFETIME_CONDITION(AAtomFirearm, bIsSlideLockActive, COND_SkipOwner);
 	DOREPLIFETIME_CONDITION(AAtomFirearm, bIsChamberEmpty, COND_SkipOwner);
+	DOREPLIFETIME_CONDITION(AAtomFirearm, ShotRandomSeed, COND_InitialOnly);
 }
 
 void AAtomFirearm::StartFiringSequence()
@@ -787,6 +964,9 @@ void AAtomFirearm::StartFiringSequence()
 
 void AAtomFirearm::StopFiringSequence()
 {
+	// Send the tail of the sequence now rather than waiting for the batch interval
+	FlushPendingShots();
+
 	if (MuzzleFXComponent && MuzzleFXComponent->IsActive() && MuzzleFXComponent->Template->IsLooping())
 	{
 		MuzzleFXComponent->DeactivateSystem();
@@ -814,6 +994,11 @@ void AAtomFirearm::PostInitializeComponents()
 {
 	Super::PostInitializeComponents();
 
+	if (HasAuthority())
+	{
+		ShotRandomSeed = FMath::Rand();
+	}
+
 	if (CartridgeEjectTemplate && GetNetMode() != ENetMode::NM_DedicatedServer)
 	{
 		CartridgeEjectComponent = UGameplayStatics::SpawnEmitterAttached(CartridgeEjectTemplate, GetMesh(), CartridgeAttachSocket, 
@@ -845,6 +1030,22 @@ bool AAtomFirearm::ReplicateSubobjects(class UActorChannel *Channel, class FOutB
 	return WroteSomething;
 }
 
+void AAtomFirearm::Unequip(const EEquipType EquipType)
+{
+	// Shots still pending would reach the server after ServerUnequip and be rejected
+	FlushPendingShots();
+
+	Super::Unequip(EquipType);
+}
+
+void AAtomFirearm::Equip(const EHand Hand, const EEquipType EquipType)
+{
+	// Owner and server both restart the sequence here. Shots are sent after ServerEquip on the same channel.
+	ShotSequence = 0;
+
+	Super::Equip(Hand, EquipType);
+}
+
 void AAtomFirearm::OnEquipped()
 {
 	Super::OnEquipped();
@@ -855,6 +1056,8 @@ void AAtomFirearm::OnEquipped()
 
 void AAtomFirearm::OnUnequipped()
 {
+	FlushPendingShots();
+
 	Super::OnUnequipped();
 
 	AmmoLoader->OnUnequipped();
@@ -876,4 +1079,67 @@ void AAtomFirearm::Destroyed()
 	Super::Destroyed();
 }
 
+void AAtomFirearm::OnPooled()
+{
+	Super::OnPooled();
+
+	// Help indicators belong to the last owner
+	if (GetCharacterOwner() && GetCharacterOwner()->IsLocallyControlled())
+	{
+		for (uint8 i = 0; i < static_cast<uint8>(EHelpIndicatorType::MAX_COUNT); ++i)
+		{
+			ClearHelp(static_cast<EHelpIndicatorType>(i));
+		}
+	}
+
+	AmmoLoader->OnPooled();
+}
+
+void AAtomFirearm::OnUnpooled()
+{
+	Super::OnUnpooled();
+
+	ensure(StateStack.Num() == 1 && StateStack.Top() == GetInactiveState());
+
+	if (UEquippableStateFiring* const Firing = Cast<UEquippableStateFiring>(FiringState))
+	{
+		Firing->ResetFiring();
+	}
+
+	// Chamber
+	bIsChamberEmpty = false;
+	CartridgeMeshComponent->SetVisibility(true);
+	CartridgeMeshComponent->SetStaticMesh(CartridgeUnfiredMesh);
+
+	// Slide lock and chambering handle
+	if (bIsSlideLockActive)
+	{
+		bIsSlideLockActive = false;
+
+		if (UAnimInstance* const AnimInstance = GetMesh<USkeletalMeshComponent>()->GetAnimInstance())
+		{
+			AnimInstance->Montage_Stop(0.f, FiringMontage);
+		}
+	}
+
+	bIsHoldingChamberHandle = false;
+	ChamberingProgress = 0.f;
+	ChamberingIndex = 0;
+	LastChamberState = EChamberState::Set;
+
+	// Recoil
+	RecoilVelocity.Angular = FVector::ZeroVector;
+	RecoilVelocity.Directional = FVector::ZeroVector;
+	bIsRecoilActive = false;
+
+	// Shots
+	PendingShots.Shots.Reset();
+	PendingShotTimes.Reset();
+	LastShotBatchTime = 0.f;
+	ShotSequence = 0;
+	ServerShotBudget = FTokenBucket{};
+
+	AmmoLoader->OnUnpooled();
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
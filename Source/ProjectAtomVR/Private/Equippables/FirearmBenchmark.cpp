@@ -0,0 +1,108 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#include "ProjectAtomVR.h"
+#include "FirearmBenchmark.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogFirearmBenchmark, Log, All);
+
+namespace
+{
+	struct FTimerSamples
+	{
+		uint64 Count = 0;
+		uint64 TotalCycles = 0;
+		uint32 MaxCycles = 0;
+	};
+
+	const TCHAR* TimerNames[] =
+	{
+		TEXT("FireShot"),
+		TEXT("ReloadChamber"),
+		TEXT("UpdateChamberingHandle"),
+		TEXT("UpdateRecoilOffset"),
+	};
+
+	static_assert(ARRAY_COUNT(TimerNames) == static_cast<int32>(EFirearmBenchmarkTimer::Max), "TimerNames must match EFirearmBenchmarkTimer");
+
+	FTimerSamples Samples[static_cast<int32>(EFirearmBenchmarkTimer::Max)];
+
+	double StartTime = 0.0;
+}
+
+bool FFirearmBenchmark::bIsRecording = false;
+
+void FFirearmBenchmark::Start()
+{
+	if (bIsRecording)
+	{
+		UE_LOG(LogFirearmBenchmark, Warning, TEXT("Firearm benchmark already recording."));
+		return;
+	}
+
+	for (FTimerSamples& TimerSamples : Samples)
+	{
+		TimerSamples = FTimerSamples{};
+	}
+
+	StartTime = FPlatformTime::Seconds();
+	bIsRecording = true;
+}
+
+void FFirearmBenchmark::Stop(const FString& Name)
+{
+	if (!bIsRecording)
+		return;
+
+	bIsRecording = false;
+
+	WriteResults(Name, FPlatformTime::Seconds() - StartTime);
+}
+
+void FFirearmBenchmark::AddSample(EFirearmBenchmarkTimer Timer, uint32 Cycles)
+{
+	FTimerSamples& TimerSamples = Samples[static_cast<int32>(Timer)];
+	++TimerSamples.Count;
+	TimerSamples.TotalCycles += Cycles;
+	TimerSamples.MaxCycles = FMath::Max(TimerSamples.MaxCycles, Cycles);
+}
+
+int32 FFirearmBenchmark::GetSampleCount(EFirearmBenchmarkTimer Timer)
+{
+	return static_cast<int32>(Samples[static_cast<int32>(Timer)].Count);
+}
+
+void FFirearmBenchmark::WriteResults(const FString& Name, double ElapsedTime)
+{
+	FString Json = TEXT("{\n");
+	Json += FString::Printf(TEXT("\t\"name\": \"%s\",\n"), *Name);
+	Json += FString::Printf(TEXT("\t\"duration_seconds\": %.3f,\n"), ElapsedTime);
+	Json += TEXT("\t\"timers\": [\n");
+
+	for (int32 i = 0; i < ARRAY_COUNT(Samples); ++i)
+	{
+		const FTimerSamples& TimerSamples = Samples[i];
+		const double TotalMs = TimerSamples.TotalCycles * FPlatformTime::GetSecondsPerCycle() * 1000.0;
+		const double AverageUs = (TimerSamples.Count > 0) ? TotalMs * 1000.0 / TimerSamples.Count : 0.0;
+		const double MaxUs = TimerSamples.MaxCycles * FPlatformTime::GetSecondsPerCycle() * 1000000.0;
+
+		Json += FString::Printf(TEXT("\t\t{ \"name\": \"%s\", \"count\": %llu, \"total_ms\": %.4f, \"avg_us\": %.3f, \"max_us\": %.3f }%s\n"),
+			TimerNames[i], TimerSamples.Count, TotalMs, AverageUs, MaxUs, (i + 1 < ARRAY_COUNT(Samples)) ? TEXT(",") : TEXT(""));
+
+		UE_LOG(LogFirearmBenchmark, Log, TEXT("%s %s: %llu calls, %.4f ms total, %.3f us avg, %.3f us max"),
+			*Name, TimerNames[i], TimerSamples.Count, TotalMs, AverageUs, MaxUs);
+	}
+
+	Json += TEXT("\t]\n}\n");
+
+	const FString FileName = FPaths::ProfilingDir() / TEXT("FirearmBenchmark") /
+		FString::Printf(TEXT("FirearmBenchmark-%s-%s.json"), *Name, *FDateTime::Now().ToString());
+
+	if (FFileHelper::SaveStringToFile(Json, *FileName))
+	{
+		UE_LOG(LogFirearmBenchmark, Log, TEXT("Firearm benchmark results written to %s"), *FileName);
+	}
+	else
+	{
+		UE_LOG(LogFirearmBenchmark, Warning, TEXT("Failed to write firearm benchmark results to %s"), *FileName);
+	}
+}
@@ -0,0 +1,114 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#include "ProjectAtomVR.h"
+#include "FirearmDiagnostics.h"
+
+DEFINE_LOG_CATEGORY(LogFirearm);
+
+// Dumps are written on their own category so they show regardless of the LogFirearm verbosity
+DEFINE_LOG_CATEGORY_STATIC(LogFirearmDiagnostics, Log, All);
+
+namespace
+{
+	struct FTraceRecord
+	{
+		float Time;
+		uint32 Frame;
+		FName FirearmName;
+		const TCHAR* Event;
+		int32 Value0;
+		int32 Value1;
+		EFirearmTraceCategory Category;
+		bool bHasAuthority;
+	};
+
+	const TCHAR* CategoryNames[] =
+	{
+		TEXT("Fire"),
+		TEXT("Reload"),
+		TEXT("Recoil"),
+		TEXT("Network"),
+	};
+
+	static_assert(ARRAY_COUNT(CategoryNames) == static_cast<int32>(EFirearmTraceCategory::Max), "CategoryNames must match EFirearmTraceCategory");
+
+	FTraceRecord TraceRecords[FFirearmDiagnostics::TraceCapacity];
+	int32 TraceHead = 0; // Index of the next record to write
+	int32 TraceNum = 0; // Number of valid records
+
+	FTokenBucket LogBuckets[static_cast<int32>(EFirearmTraceCategory::Max)];
+
+	static TAutoConsoleVariable<int32> CVarFirearmTrace(
+		TEXT("s.FirearmTrace"),
+		1,
+		TEXT("Records firearm events into the trace ring buffer. Dump with s.DumpFirearmTrace."),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarFirearmLogRate(
+		TEXT("s.FirearmLogRate"),
+		5.f,
+		TEXT("Max firearm log messages a second for each diagnostics category."),
+		ECVF_Default);
+}
+
+static FAutoConsoleCommand DumpFirearmTraceCommand(
+	TEXT("s.DumpFirearmTrace"),
+	TEXT("Logs the most recent firearm trace records.\n")
+	TEXT("Usage: s.DumpFirearmTrace [Count=1024], s.DumpFirearmTrace clear"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() > 0 && Args[0] == TEXT("clear"))
+		{
+			FFirearmDiagnostics::ClearTrace();
+			return;
+		}
+
+		FFirearmDiagnostics::DumpTrace((Args.Num() > 0) ? FCString::Atoi(*Args[0]) : FFirearmDiagnostics::TraceCapacity);
+	}));
+
+void FFirearmDiagnostics::Trace(EFirearmTraceCategory Category, const AActor* Firearm, const TCHAR* Event, int32 Value0 /*= 0*/, int32 Value1 /*= 0*/)
+{
+	if (CVarFirearmTrace.GetValueOnGameThread() == 0 || Firearm == nullptr)
+		return;
+
+	FTraceRecord& Record = TraceRecords[TraceHead];
+	Record.Time = Firearm->GetWorld()->GetTimeSeconds();
+	Record.Frame = static_cast<uint32>(GFrameCounter);
+	Record.FirearmName = Firearm->GetFName();
+	Record.Event = Event;
+	Record.Value0 = Value0;
+	Record.Value1 = Value1;
+	Record.Category = Category;
+	Record.bHasAuthority = Firearm->HasAuthority();
+
+	TraceHead = (TraceHead + 1) % TraceCapacity;
+	TraceNum = FMath::Min(TraceNum + 1, static_cast<int32>(TraceCapacity));
+}
+
+bool FFirearmDiagnostics::ShouldLog(EFirearmTraceCategory Category)
+{
+	const float LogRate = CVarFirearmLogRate.GetValueOnGameThread();
+	return LogBuckets[static_cast<int32>(Category)].TryConsume(static_cast<float>(FPlatformTime::Seconds() - GStartTime), LogRate, FMath::Max(LogRate, 1.f));
+}
+
+void FFirearmDiagnostics::DumpTrace(int32 MaxRecords /*= TraceCapacity*/)
+{
+	const int32 NumToDump = FMath::Clamp(MaxRecords, 0, TraceNum);
+
+	UE_LOG(LogFirearmDiagnostics, Log, TEXT("Firearm trace, %d of %d records:"), NumToDump, TraceNum);
+
+	for (int32 i = NumToDump; i > 0; --i)
+	{
+		const FTraceRecord& Record = TraceRecords[(TraceHead - i + TraceCapacity) % TraceCapacity];
+
+		UE_LOG(LogFirearmDiagnostics, Log, TEXT("[%8.3f][%6u] %-7s %-9s %s %s %d %d"), Record.Time, Record.Frame,
+			CategoryNames[static_cast<int32>(Record.Category)], Record.bHasAuthority ? TEXT("Authority") : TEXT("Client"),
+			*Record.FirearmName.ToString(), Record.Event, Record.Value0, Record.Value1);
+	}
+}
+
+void FFirearmDiagnostics::ClearTrace()
+{
+	TraceHead = 0;
+	TraceNum = 0;
+}
@@ -27,3 +27,11 @@ AFirearmMagazine::AFirearmMagazine(const FObjectInitializer& ObjectInitializer /
 	LoadTrigger->SetCollisionResponseToAllChannels(ECR_Ignore);
 	LoadTrigger->SetCollisionResponseToChannel(AtomCollisionChannels::FirearmReloadTrigger, ECollisionResponse::ECR_Overlap);
 }
+
+void AFirearmMagazine::OnUnpooled()
+{
+	Super::OnUnpooled();
+
+	// Disabled when discarded
+	LoadTrigger->bGenerateOverlapEvents = true;
+}
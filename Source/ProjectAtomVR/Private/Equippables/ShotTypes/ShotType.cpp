@@ -5,6 +5,69 @@
 
 #include "AtomFirearm.h"
 
+namespace
+{
+	// Batch delay is sent in whole milliseconds
+	constexpr float BatchDelayScale = 1000.f;
+
+	void SerializeBatchDelay(FArchive& Ar, FShotData& Shot)
+	{
+		uint8 DelayMs = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Shot.BatchDelay * BatchDelayScale), 0, 255));
+		Ar << DelayMs;
+
+		if (Ar.IsLoading())
+		{
+			Shot.BatchDelay = DelayMs / BatchDelayScale;
+		}
+	}
+}
+
+bool FShotBatch::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	uint32 NumShots = Shots.Num();
+	Ar.SerializeInt(NumShots, MaxShots + 1);
+
+	if (Ar.IsLoading())
+	{
+		Shots.SetNum(NumShots);
+	}
+
+	if (NumShots == 0)
+		return true;
+
+	FShotData& First = Shots[0];
+	bool bStartSuccess = true;
+	bool bDirectionSuccess = true;
+	First.Start.NetSerialize(Ar, Map, bStartSuccess);
+	First.Direction.NetSerialize(Ar, Map, bDirectionSuccess);
+	bOutSuccess &= bStartSuccess && bDirectionSuccess;
+	Ar << First.Seed;
+	SerializeBatchDelay(Ar, First);
+
+	// Shots in a batch are fired within a net update of each other, so the muzzle has barely moved.
+	// Starts are sent relative to the first start.
+	for (uint32 i = 1; i < NumShots; ++i)
+	{
+		FShotData& Shot = Shots[i];
+
+		FVector StartDelta = Shot.Start - First.Start;
+		bOutSuccess &= SerializePackedVector<10, 16>(StartDelta, Ar);
+		Shot.Direction.NetSerialize(Ar, Map, bDirectionSuccess);
+		bOutSuccess &= bDirectionSuccess;
+		SerializeBatchDelay(Ar, Shot);
+
+		if (Ar.IsLoading())
+		{
+			Shot.Start = First.Start + StartDelta;
+			Shot.Seed = First.Seed + i;
+		}
+	}
+
+	return true;
+}
+
 void UShotType::SimulateShot(const FShotData& ShotData)
 {
 
@@ -4,8 +4,14 @@
 #include "ShotTypeInstant.h"
 #include "AtomFirearm.h"
 #include "Effects/AtomImpactEffect.h"
+#include "Effects/AtomEffectPool.h"
+#include "AtomLagCompensationComponent.h"
 #include "IConsoleManager.h"
 
+DECLARE_CYCLE_STAT(TEXT("Shot Trace"), STAT_ShotTrace, STATGROUP_ProjectAtom);
+DECLARE_CYCLE_STAT(TEXT("Shot Process Impact"), STAT_ShotProcessImpact, STATGROUP_ProjectAtom);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shot Traces"), STAT_ShotTraces, STATGROUP_ProjectAtom);
+
 namespace
 {
 	static constexpr float MAX_SHOT_RANGE = 10000.f;
@@ -17,37 +23,37 @@ FShotData UShotTypeInstant::GetShotData() const
 	
 	FShotData ShotData;
 	ShotData.Start = Firearm->GetMuzzleLocation();
-	ShotData.End = ShotData.Start + Firearm->GetMuzzleRotation().Vector() * MAX_SHOT_RANGE;
-
-	ShotData.Seed = static_cast<uint8>(FMath::Rand() % 256);
+	ShotData.Direction = Firearm->GetMuzzleRotation().Vector();
 
 	return ShotData;
 }
 
-void UShotTypeInstant::SimulateShot(const FShotData& ShotData)
+void UShotTypeInstant::GetShotEnds(const FShotData& ShotData, FRandomStream& RandomStream, TArray<FVector, TInlineAllocator<8>>& OutEnds) const
 {
-	FMath::RandInit(ShotData.Seed);
+	OutEnds.Reset();
 
 	if (ShotCount > 1 || SpreadConeHalfAngleRad > 0.f)
 	{
-		const FVector ShotVector = (ShotData.End - ShotData.Start);
-		const float ShotDistance = ShotVector.Size();
-
 		for (int32 i = 0; i < ShotCount; ++i)
 		{
-			const FVector OffsetDirection = FMath::VRandCone(ShotVector, SpreadConeHalfAngleRad);
-
-			const FHitResult Impact = WeaponTrace(ShotData.Start, OffsetDirection * ShotDistance);
-
-			if (Impact.bBlockingHit)
-				PlayImpactEffects(Impact);
-
-			PlayTrailEffects(ShotData.Start, Impact.ImpactPoint);
+			const FVector OffsetDirection = RandomStream.VRandCone(ShotData.Direction, SpreadConeHalfAngleRad);
+			OutEnds.Add(ShotData.Start + OffsetDirection * MAX_SHOT_RANGE);
 		}
 	}
 	else
 	{
-		const FHitResult Impact = WeaponTrace(ShotData.Start, ShotData.End);
+		OutEnds.Add(ShotData.Start + ShotData.Direction * MAX_SHOT_RANGE);
+	}
+}
+
+void UShotTypeInstant::SimulateShot(const FShotData& ShotData)
+{
+	TArray<FVector, TInlineAllocator<8>> ShotEnds;
+	GetShotEnds(ShotData, GetFirearm()->GetShotRandomStream(), ShotEnds);
+
+	for (const FVector& End : ShotEnds)
+	{
+		const FHitResult Impact = WeaponTrace(ShotData.Start, End);
 
 		if (Impact.bBlockingHit)
 			PlayImpactEffects(Impact);
@@ -58,30 +64,33 @@ void UShotTypeInstant::SimulateShot(const FShotData& ShotData)
 
 void UShotTypeInstant::FireShot(const FShotData& ShotData)
 {
-	FMath::RandInit(ShotData.Seed);
+	// Spread is derived here from the shot seed rather than trusting pellet directions from the client
+	TArray<FVector, TInlineAllocator<8>> ShotEnds;
+	GetShotEnds(ShotData, GetFirearm()->GetShotRandomStream(), ShotEnds);
+
+	// Trace all shots against the world as the shooter saw it, then process impacts once everything
+	// is restored so damage and death are applied to current positions.
+	TArray<FHitResult, TInlineAllocator<8>> Impacts;
 
-	if (ShotCount > 1 || SpreadConeHalfAngleRad > 0.f)
 	{
-		const FVector ShotVector = (ShotData.End - ShotData.Start);
-		const float ShotDistance = ShotVector.Size();
+		FScopedLagCompensation LagCompensation{ GetFirearm()->GetCharacterOwner(), ShotData.BatchDelay };
 
-		for (int32 i = 0; i < ShotCount; ++i)
+		for (const FVector& End : ShotEnds)
 		{
-			const FVector OffsetDirection = FMath::VRandCone(ShotVector, SpreadConeHalfAngleRad);
-
-			const FHitResult Impact = WeaponTrace(ShotData.Start, OffsetDirection * ShotDistance);
-			ProcessFiredShotImpact(Impact);
+			Impacts.Add(WeaponTrace(ShotData.Start, End));
 		}
 	}
-	else
+
+	for (const FHitResult& Impact : Impacts)
 	{
-		const FHitResult Impact = WeaponTrace(ShotData.Start, ShotData.End);
 		ProcessFiredShotImpact(Impact);
 	}
 }
 
 void UShotTypeInstant::ProcessFiredShotImpact(const FHitResult& Impact)
 {
+	SCOPE_CYCLE_COUNTER(STAT_ShotProcessImpact);
+
 	AAtomFirearm* const Firearm = GetFirearm();
 
 	if (Impact.bBlockingHit && Impact.Actor.IsValid())
@@ -106,11 +115,13 @@ void UShotTypeInstant::ProcessFiredShotImpact(const FHitResult& Impact)
 
 void UShotTypeInstant::PlayTrailEffects(const FVector& Start, const FVector& End) const
 {
-	if (TrailFX)
+	AAtomEffectPool* const EffectPool = AAtomEffectPool::Get(this);
+
+	if (TrailFX && EffectPool)
 	{
 		const FVector DirectionVector = (End - Start);
 
-		UParticleSystemComponent* TrailComponent = UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), TrailFX, Start, DirectionVector.GetUnsafeNormal().Rotation());
+		UParticleSystemComponent* TrailComponent = EffectPool->SpawnEmitterAtLocation(TrailFX, Start, DirectionVector.GetUnsafeNormal().Rotation());
 		TrailComponent->SetFloatParameter(TEXT("Distance"), DirectionVector.Size());		
 	}
 }
@@ -132,6 +143,9 @@ static TAutoConsoleVariable<int32> CVarDebugInstantShot(
 
 FHitResult UShotTypeInstant::WeaponTrace(const FVector& Start, const FVector& End) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_ShotTrace);
+	INC_DWORD_STAT(STAT_ShotTraces);
+
 	FHitResult Impact;
 	FCollisionQueryParams QueryParams{ NAME_None, false };
 	QueryParams.bReturnPhysicalMaterial = true;
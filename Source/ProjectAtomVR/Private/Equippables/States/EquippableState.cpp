@@ -17,9 +17,11 @@ void UEquippableState::OnEnteredState()
 {
 	if (Equippable->GetCharacterOwner()->IsLocallyControlled())
 	{
-		UInputComponent* const InputComponent = Equippable->InputComponent;
-		check(InputComponent && "InputComponent should always be valid on locally controlled Equippables.");
-		BindStateInputs(InputComponent);
+		// Only valid when controlled by a player
+		if (UInputComponent* const InputComponent = Equippable->InputComponent)
+		{
+			BindStateInputs(InputComponent);
+		}
 	}
 }
 
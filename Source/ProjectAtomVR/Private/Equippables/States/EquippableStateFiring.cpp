@@ -6,6 +6,7 @@
 #include "AtomEquippable.h"
 #include "Components/InputComponent.h"
 #include "AtomFirearm.h"
+#include "FirearmDiagnostics.h"
 
 void UEquippableStateFiring::OnEnteredState()
 {
@@ -56,6 +57,15 @@ void UEquippableStateFiring::Deactivate()
 	Super::Deactivate();
 }
 
+void UEquippableStateFiring::ResetFiring()
+{
+	BurstCount = CastChecked<UEquippableStateFiring>(GetArchetype())->BurstCount;
+
+	ShotsFired = 0;
+	LastShotTimestamp = 0.f;
+	RemoteShotCounter = ServerShotCounter;
+}
+
 void UEquippableStateFiring::OnTriggerReleased()
 {
 	GetEquippable()->PopState(this);
@@ -114,7 +124,7 @@ void UEquippableStateFiring::OnFireSimulatedShot()
 {
 	AAtomFirearm* const Firearm = GetEquippable<AAtomFirearm>();
 
-	UE_LOG(LogFirearm, Verbose, TEXT("OnFireSimulatedShot by %s"), Firearm->HasAuthority() ? TEXT("Authority") : TEXT("Client"));
+	FFirearmDiagnostics::Trace(EFirearmTraceCategory::Fire, Firearm, TEXT("OnFireSimulatedShot"), ShotsFired);
 
 	Firearm->FireShot();
 
@@ -142,7 +152,7 @@ void UEquippableStateFiring::OnFireShot()
 {
 	AAtomFirearm* const Firearm = GetEquippable<AAtomFirearm>();
 
-	UE_LOG(LogFirearm, Log, TEXT("OnFireShot by %s"), Firearm->HasAuthority() ? TEXT("Authority") : TEXT("Client"));
+	FFirearmDiagnostics::Trace(EFirearmTraceCategory::Fire, Firearm, TEXT("OnFireShot"), ShotsFired);
 
 	if (!Firearm->CanFire())
 	{
@@ -178,8 +188,9 @@ void UEquippableStateFiring::OnFireShot()
 
 void UEquippableStateFiring::OnDryFire()
 {
-	UE_LOG(LogFirearm, Log, TEXT("OnFalseFire by %s"), GetEquippable<AAtomFirearm>()->HasAuthority() ? TEXT("Authority") : TEXT("Client"));
 	AAtomFirearm* const Firearm = GetEquippable<AAtomFirearm>();
+	FFirearmDiagnostics::Trace(EFirearmTraceCategory::Fire, Firearm, TEXT("OnDryFire"), ShotsFired);
+
 	bDryFireNotify = !bDryFireNotify;
 	Firearm->DryFire();
 	Firearm->PopState(this);
@@ -190,10 +201,10 @@ void UEquippableStateFiring::OnRep_TotalShotCounter()
 	const int32 ShotDiff = FMath::Abs(ServerShotCounter - RemoteShotCounter); // Abs to allow wrapping
 	RemoteShotCounter = ServerShotCounter;
 
-	UE_LOG(LogFirearm, Log, TEXT("OnRep_TotalShotCounter with ShotDiff =  %d"), ShotDiff);
-
 	AAtomFirearm* const Firearm = GetEquippable<AAtomFirearm>();
 
+	FFirearmDiagnostics::Trace(EFirearmTraceCategory::Network, Firearm, TEXT("OnRep_TotalShotCounter"), ShotDiff, ServerShotCounter);
+
 	if (Firearm->HasActorBegunPlay())
 	{
 		if (ShotDiff > 0)
@@ -8,6 +8,8 @@
 #include "VRHUD.h"
 #include "AtomPlayerState.h"
 
+DECLARE_CYCLE_STAT(TEXT("GameMode DefaultTimer"), STAT_GameModeDefaultTimer, STATGROUP_ProjectAtom);
+
 AAtomBaseGameMode::AAtomBaseGameMode()
 {
 	GameStateClass = AAtomGameState::StaticClass();
@@ -51,6 +53,8 @@ bool AAtomBaseGameMode::ShouldDelayCharacterLoadoutCreation() const
 
 void AAtomBaseGameMode::DefaultTimer()
 {
+	SCOPE_CYCLE_COUNTER(STAT_GameModeDefaultTimer);
+
 	FTimerManager& TimerManager = GetWorldTimerManager();
 	TimerManager.SetTimer(TimerHandle_DefaultTimer, this, &AAtomBaseGameMode::DefaultTimer, GetWorldSettings()->GetEffectiveTimeDilation() / GetWorldSettings()->DemoPlayTimeDilation, true);
 
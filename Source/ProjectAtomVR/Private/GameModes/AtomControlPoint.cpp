@@ -8,6 +8,8 @@
 #include "Components/PrimitiveComponent.h"
 #include "AtomObjectiveMessage.h"
 
+DECLARE_CYCLE_STAT(TEXT("ControlPoint Tick"), STAT_ControlPointTick, STATGROUP_ProjectAtom);
+
 AAtomControlPoint::AAtomControlPoint()
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -41,7 +43,7 @@ AAtomControlPoint::AAtomControlPoint()
 
 	ObjectiveMessageClass = UAtomObjectiveMessage::StaticClass();
 
-	TeamOverlaps.SetNum(2); // Most, if not all, games will have 2 teams
+	TeamPresence.SetNumZeroed(2); // Most, if not all, games will have 2 teams
 	bIsActive = false;
 	bIsCaptured = false;
 
@@ -69,7 +71,7 @@ void AAtomControlPoint::Deactivate()
 
 	SetActorHiddenInGame(true);
 	GetWorldTimerManager().ClearTimer(ActivationHandle);
-	TeamOverlaps.Empty(2);
+	ResetPresence();
 	CaptureBounds->bGenerateOverlapEvents = false;
 	bIsActive = false;
 }
@@ -93,17 +95,19 @@ TArray<AAtomPlayerState*> AAtomControlPoint::GetActiveControllingTeamMembers() c
 {
 	TArray<AAtomPlayerState*> ActivePlayerStates;
 
-	// Get initial overlaps
-	TArray<AActor*> ActiveOverlaps;
-	CaptureBounds->GetOverlappingActors(ActiveOverlaps, AAtomCharacter::StaticClass());
+	if (ControllingTeam == nullptr)
+		return ActivePlayerStates;
 
-	for (AActor* InitialOverlap : ActiveOverlaps)
-	{
-		auto PlayerState = Cast<AAtomPlayerState>(CastChecked<AAtomCharacter>(InitialOverlap)->PlayerState);
+	ActivePlayerStates.Reserve(GetTeamPresence(ControllingTeam->TeamId));
 
-		if (PlayerState && PlayerState->GetTeam() == ControllingTeam)
+	for (const auto& Pair : PresentCharacters)
+	{
+		if (Pair.Value == ControllingTeam->TeamId)
 		{
-			ActivePlayerStates.Add(PlayerState);
+			if (auto PlayerState = Cast<AAtomPlayerState>(Pair.Key->PlayerState))
+			{
+				ActivePlayerStates.Add(PlayerState);
+			}
 		}
 	}
 
@@ -135,6 +139,8 @@ void AAtomControlPoint::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Ou
 
 void AAtomControlPoint::Tick(float DeltaSeconds)
 {
+	SCOPE_CYCLE_COUNTER(STAT_ControlPointTick);
+
 	Super::Tick(DeltaSeconds);
 
 	check(HasAuthority() && "Only authority should be ticking!");
@@ -143,7 +149,7 @@ void AAtomControlPoint::Tick(float DeltaSeconds)
 	if (ControlState == EControlState::Capturing)
 	{
 		// Get overlapping team count
-		const int32 TeamInfluence = FMath::Min(MaxTeamInfluence, TeamOverlaps[ControllingTeam->TeamId].Num());
+		const int32 TeamInfluence = FMath::Min(MaxTeamInfluence, GetTeamPresence(ControllingTeam->TeamId));
 		const float Rate = ControlRate + (TeamInfluence - 1) * ControlRateMultiplier * ControlRate;
 		ensure(Rate > 0);
 
@@ -160,14 +166,7 @@ void AAtomControlPoint::Tick(float DeltaSeconds)
 	else if (ControlState == EControlState::Lossing)
 	{
 		// Get overlapping enemy count
-		int32 TeamInfluence = 0;
-		for (auto Overlaps : TeamOverlaps)
-		{
-			TeamInfluence += Overlaps.Num();
-		}
-
-		TeamInfluence -= TeamOverlaps[ControllingTeam->TeamId].Num();
-		TeamInfluence = FMath::Min(MaxTeamInfluence, TeamInfluence);
+		const int32 TeamInfluence = FMath::Min(MaxTeamInfluence, GetTotalPresence() - GetTeamPresence(ControllingTeam->TeamId));
 
 		const float Rate = ControlRate + (TeamInfluence - 1) * ControlRateMultiplier * ControlRate;
 		ensure(Rate > 0);
@@ -242,24 +241,11 @@ void AAtomControlPoint::OnBoundsBeginOverlap(UPrimitiveComponent* OverlappedComp
 {
 	ensureMsgf(Cast<AAtomCharacter>(OtherActor) != nullptr, TEXT("Control points should only respond to AtomCharacter overlaps."));
 
-	if (auto Character = Cast<AAtomCharacter>(OtherActor))
+	// Only the capsule counts, so ragdolls and multiple overlapping components don't affect presence
+	auto Character = Cast<AAtomCharacter>(OtherActor);
+	if (Character && OtherComp == Character->GetCapsuleComponent())
 	{
-		if (auto PlayerState = Cast<AAtomPlayerState>(Character->PlayerState))
-		{
-			if (AAtomTeamInfo* Team = PlayerState->GetTeam())
-			{
-				const int32 TeamId = Team->TeamId;
-
-				if (!TeamOverlaps.IsValidIndex(TeamId))
-				{
-					TeamOverlaps.SetNum(TeamId + 1, false);
-				}
-
-				check(TeamOverlaps[TeamId].Find(Character) == INDEX_NONE);
-				TeamOverlaps[TeamId].Add(Character);
-				UpdateControlState();
-			}
-		}
+		AddPresence(Character);
 	}
 }
 
@@ -267,31 +253,68 @@ void AAtomControlPoint::OnBoundsEndOverlap(UPrimitiveComponent* OverlappedCompon
 {
 	ensureMsgf(Cast<AAtomCharacter>(OtherActor) != nullptr, TEXT("Control points should only respond to AtomCharacter overlaps."));
 
-	if (!bIsActive) // TeamOverlaps are cleared on deactivate
+	if (!bIsActive) // Presence is cleared on deactivate
 		return;
 
-	if (auto Character = Cast<AAtomCharacter>(OtherActor))
+	auto Character = Cast<AAtomCharacter>(OtherActor);
+	if (Character && OtherComp == Character->GetCapsuleComponent())
 	{
-		if (auto PlayerState = Cast<AAtomPlayerState>(Character->PlayerState))
-		{
-			if (AAtomTeamInfo* Team = PlayerState->GetTeam())
-			{
-				const int32 TeamId = Team->TeamId;
+		RemovePresence(Character);
+	}
+}
 
-				check(TeamOverlaps.IsValidIndex(TeamId));
-				TeamOverlaps[TeamId].RemoveSingle(Character);
-				UpdateControlState();
-			}
-		}
-		else
-		{
-			// Character may be killed and no longer have a playerstate. Make sure the character is removed from any
-			// team overlaps.
-			for (auto& TeamOverlap : TeamOverlaps)
-			{
-				TeamOverlap.RemoveSingle(Character);
-			}
-		}
+void AAtomControlPoint::AddPresence(AAtomCharacter* Character)
+{
+	if (Character->IsDying() || PresentCharacters.Contains(Character))
+		return;
+
+	auto PlayerState = Cast<AAtomPlayerState>(Character->PlayerState);
+	AAtomTeamInfo* const Team = PlayerState ? PlayerState->GetTeam() : nullptr;
+
+	if (Team == nullptr)
+		return;
+
+	const int32 TeamId = Team->TeamId;
+
+	if (!TeamPresence.IsValidIndex(TeamId))
+	{
+		TeamPresence.SetNumZeroed(TeamId + 1);
+	}
+
+	PresentCharacters.Add(Character, TeamId);
+
+	if (TeamPresence[TeamId]++ == 0)
+	{
+		++NumTeamsPresent;
+	}
+
+	UpdateControlState();
+}
+
+void AAtomControlPoint::RemovePresence(const AAtomCharacter* Character)
+{
+	int32 TeamId;
+	if (!PresentCharacters.RemoveAndCopyValue(Character, TeamId))
+		return;
+
+	check(TeamPresence.IsValidIndex(TeamId) && TeamPresence[TeamId] > 0);
+
+	if (--TeamPresence[TeamId] == 0)
+	{
+		--NumTeamsPresent;
+	}
+
+	UpdateControlState();
+}
+
+void AAtomControlPoint::ResetPresence()
+{
+	PresentCharacters.Reset();
+	NumTeamsPresent = 0;
+
+	for (int32& Presence : TeamPresence)
+	{
+		Presence = 0;
 	}
 }
 
@@ -306,25 +329,15 @@ void AAtomControlPoint::OnActivated()
 		PrimaryActorTick.SetTickFunctionEnable(true);
 
 		// Get initial overlaps
-		TArray<AActor*> InitalOverlaps;
-		CaptureBounds->GetOverlappingActors(InitalOverlaps, AAtomCharacter::StaticClass());
+		TArray<UPrimitiveComponent*> InitialOverlaps;
+		CaptureBounds->GetOverlappingComponents(InitialOverlaps);
 
-		for (AActor* InitialOverlap : InitalOverlaps)
+		for (UPrimitiveComponent* InitialOverlap : InitialOverlaps)
 		{
-			auto Character = CastChecked<AAtomCharacter>(InitialOverlap);
-			auto PlayerState = Cast<AAtomPlayerState>(Character->PlayerState);
-
-			if (PlayerState && PlayerState->GetTeam())
+			auto Character = Cast<AAtomCharacter>(InitialOverlap->GetOwner());
+			if (Character && InitialOverlap == Character->GetCapsuleComponent())
 			{
-				const int32 TeamId = PlayerState->GetTeam()->TeamId;
-
-				if (!TeamOverlaps.IsValidIndex(TeamId))
-				{
-					TeamOverlaps.SetNum(TeamId + 1, false);
-				}
-
-				check(TeamOverlaps[TeamId].Find(Character) == INDEX_NONE);
-				TeamOverlaps[TeamId].Add(Character);
+				AddPresence(Character);
 			}
 		}
 
@@ -353,20 +366,9 @@ void AAtomControlPoint::UpdateControlState()
 
 	// Get the state of the control point with overlapping teams. If more that one team is on the point, go to neutral.
 	int32 OverlappingTeam = -1;
-	for (int32 i = 0; i < TeamOverlaps.Num(); ++i)
+	if (NumTeamsPresent == 1)
 	{
-		if (TeamOverlaps[i].Num() > 0)
-		{
-			if (OverlappingTeam == -1)
-			{
-				OverlappingTeam = i;
-			}
-			else
-			{
-				OverlappingTeam = -1;
-				break;
-			}
-		}
+		OverlappingTeam = TeamPresence.IndexOfByPredicate([](int32 Presence) { return Presence > 0; });
 	}
 
 	if (OverlappingTeam == -1)
@@ -375,7 +377,7 @@ void AAtomControlPoint::UpdateControlState()
 	}
 	else
 	{
-		check(TeamOverlaps.IsValidIndex(OverlappingTeam));
+		check(TeamPresence.IsValidIndex(OverlappingTeam));
 
 		if (ControllingTeam == nullptr)
 		{
@@ -17,6 +17,9 @@
 #include "Messages/AtomCountdownMessage.h"
 #include "AtomObjectiveMessage.h"
 
+DECLARE_CYCLE_STAT(TEXT("Choose Player Start"), STAT_ChoosePlayerStart, STATGROUP_ProjectAtom);
+DECLARE_CYCLE_STAT(TEXT("Reset Players For Round"), STAT_ResetPlayersForRound, STATGROUP_ProjectAtom);
+
 namespace MatchState
 {
 	const FName Countdown = FName(TEXT("Countdown"));
@@ -29,6 +32,7 @@ AAtomGameMode::AAtomGameMode()
 {
 	bFirstRoundInitialized = false;
 	bMinuteWarningSent = false;
+	bRoundTimeExpired = false;
 
 	DeathMessageClass = UAtomDeathLocalMessage::StaticClass();
 	CountdownMessageClass = UAtomCountdownMessage::StaticClass();
@@ -54,6 +58,11 @@ void AAtomGameMode::InitGame(const FString& MapName, const FString& Options, FSt
 {
 	Super::InitGame(MapName, Options, ErrorMessage);
 
+	CachePlayerStarts();
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &AAtomGameMode::OnLevelChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &AAtomGameMode::OnLevelChanged);
+
 	if (UGameplayStatics::GetIntOption(Options, TEXT("bUsePlaylist"), 0) != 0)
 	{
 		if (UGameInstance* const GameInstance = GetGameInstance())
@@ -218,7 +227,7 @@ bool AAtomGameMode::ReadyToEndRound_Implementation()
 	{
 		if (AAtomGameState* const AtomGameState = GetGameState<AAtomGameState>())
 		{
-			return AtomGameState->GetGameWinner() || AtomGameState->RemainingTime < 0;
+			return AtomGameState->GetGameWinner() || bRoundTimeExpired;
 		}		
 	}
 
@@ -227,6 +236,8 @@ bool AAtomGameMode::ReadyToEndRound_Implementation()
 
 void AAtomGameMode::HandleMatchHasEnded()
 {
+	StartPhaseTimer(0.f);
+
 	Super::HandleMatchHasEnded();
 
 	TravelToNextMatch();
@@ -237,37 +248,69 @@ bool AAtomGameMode::ShouldSpawnAtStartSpot(AController* Player)
 	return false;
 }
 
-void AAtomGameMode::CheckGameTime()
+void AAtomGameMode::StartPhaseTimer(float Duration)
 {
-	Super::CheckGameTime();
+	CastChecked<AAtomGameState>(GameState)->SetPhaseDuration(Duration);
 
-	AAtomGameState* AtomGameState = CastChecked<AAtomGameState>(GameState);
+	FTimerManager& TimerManager = GetWorldTimerManager();
+	TimerManager.ClearTimer(TimerHandle_Phase);
+	TimerManager.ClearTimer(TimerHandle_PhaseSecond);
 
-	if (MatchState != MatchState::InProgress)
+	if (Duration > 0.f)
 	{
-		if (MatchState == MatchState::Countdown)
-		{
-			// Send countdown message
-			BroadcastLocalized(this, CountdownMessageClass,
-				UAtomCountdownMessage::ConstructMessageIndex(UAtomCountdownMessage::EType::RoundStart, Countdown));
+		TimerManager.SetTimer(TimerHandle_Phase, this, &AAtomGameMode::OnPhaseTimerExpired, Duration, false);
 
-			if (Countdown <= 0)
-			{
-				SetMatchState(MatchState::InProgress);
-			}
-			--Countdown;
-		}
-		else if (MatchState == MatchState::Intermission)
+		// Align second messages with the phase end rather than the phase start
+		const float FirstSecondDelay = FMath::Fmod(Duration, 1.f);
+		TimerManager.SetTimer(TimerHandle_PhaseSecond, this, &AAtomGameMode::OnPhaseSecondElapsed, 1.f, true, 
+			(FirstSecondDelay > KINDA_SMALL_NUMBER) ? FirstSecondDelay : 1.f);
+
+		if (FirstSecondDelay <= KINDA_SMALL_NUMBER)
 		{
-			if (AtomGameState->RemainingTime <= 0)
-			{
-				SetMatchState(MatchState::ExitingIntermission);
-			}
-		}		
+			OnPhaseSecondElapsed();
+		}
 	}
-	else
+}
+
+void AAtomGameMode::OnPhaseTimerExpired()
+{
+	GetWorldTimerManager().ClearTimer(TimerHandle_PhaseSecond);
+
+	if (MatchState == MatchState::Countdown)
+	{
+		BroadcastLocalized(this, CountdownMessageClass,
+			UAtomCountdownMessage::ConstructMessageIndex(UAtomCountdownMessage::EType::RoundStart, 0));
+
+		SetMatchState(MatchState::InProgress);
+	}
+	else if (MatchState == MatchState::InProgress)
+	{
+		BroadcastLocalized(this, CountdownMessageClass,
+			UAtomCountdownMessage::ConstructMessageIndex(UAtomCountdownMessage::EType::RoundEnd, 0));
+
+		// Round is ended by Tick through ReadyToEndRound
+		bRoundTimeExpired = true;
+	}
+	else if (MatchState == MatchState::Intermission)
+	{
+		SetMatchState(MatchState::ExitingIntermission);
+	}
+}
+
+void AAtomGameMode::OnPhaseSecondElapsed()
+{
+	const int32 RemainingTime = FMath::RoundToInt(CastChecked<AAtomGameState>(GameState)->GetRemainingTime());
+	if (RemainingTime <= 0)
+		return; // Phase end is handled by OnPhaseTimerExpired
+
+	if (MatchState == MatchState::Countdown)
+	{
+		// Send countdown message
+		BroadcastLocalized(this, CountdownMessageClass,
+			UAtomCountdownMessage::ConstructMessageIndex(UAtomCountdownMessage::EType::RoundStart, RemainingTime));
+	}
+	else if (MatchState == MatchState::InProgress)
 	{
-		const int32 RemainingTime = AtomGameState->RemainingTime;
 		if (RemainingTime < 60 && !bMinuteWarningSent)
 		{
 			BroadcastLocalized(this, CountdownMessageClass,
@@ -275,7 +318,7 @@ void AAtomGameMode::CheckGameTime()
 
 			bMinuteWarningSent = true;
 		}
-		else if (RemainingTime >= 0 && RemainingTime <= 10)
+		else if (RemainingTime <= 10)
 		{
 			BroadcastLocalized(this, CountdownMessageClass, 
 				UAtomCountdownMessage::ConstructMessageIndex(UAtomCountdownMessage::EType::RoundEnd, RemainingTime));
@@ -283,9 +326,53 @@ void AAtomGameMode::CheckGameTime()
 	}
 }
 
-bool AAtomGameMode::IsValidPlayerStart(AController*, APlayerStart*)
+int32 AAtomGameMode::GetPlayerStartTeam(AController*) const
 {
-	return true;
+	return INDEX_NONE;
+}
+
+void AAtomGameMode::CachePlayerStarts()
+{
+	const TArray<FCachedPlayerStart> PreviousStarts = MoveTemp(CachedPlayerStarts);
+
+	CachedPlayerStarts.Reset();
+	PlayerStartsByTeam.Reset();
+
+	TArray<int32>& AllStarts = PlayerStartsByTeam.Add(INDEX_NONE);
+
+	for (TActorIterator<APlayerStart> It(GetWorld()); It; ++It)
+	{
+		if (It->IsA<APlayerStartPIE>())
+			continue;
+
+		const FCachedPlayerStart* const Previous = PreviousStarts.FindByPredicate(
+			[&It](const FCachedPlayerStart& Cached) { return Cached.PlayerStart == *It; });
+
+		const int32 Index = Previous ? CachedPlayerStarts.Add(*Previous) : CachedPlayerStarts.AddDefaulted();
+		CachedPlayerStarts[Index].PlayerStart = *It;
+		AllStarts.Add(Index);
+
+		if (AAtomTeamStart* TeamStart = Cast<AAtomTeamStart>(*It))
+		{
+			PlayerStartsByTeam.FindOrAdd(TeamStart->TeamId).Add(Index);
+		}
+	}
+}
+
+void AAtomGameMode::OnLevelChanged(ULevel* Level, UWorld* World)
+{
+	if (World == GetWorld())
+	{
+		CachePlayerStarts();
+	}
+}
+
+void AAtomGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AAtomGameMode::ApplyPlaylistSettings(const FPlaylistItem& Playlist)
@@ -349,13 +436,12 @@ void AAtomGameMode::HandleMatchHasStarted()
 	}
 
 	// Set match timer
-	CastChecked<AAtomGameState>(GameState)->RemainingTime = TimeLimit;
+	bRoundTimeExpired = false;
+	StartPhaseTimer(TimeLimit);
 }
 
 void AAtomGameMode::HandleMatchEnteredCountdown()
 {	
-	Countdown = CountdownTime;
-
 	if (!bFirstRoundInitialized)
 	{
 		GameSession->HandleMatchHasStarted();
@@ -405,7 +491,7 @@ void AAtomGameMode::HandleMatchEnteredCountdown()
 		GetGameInstance()->StartRecordingReplay(GetWorld()->GetMapName(), GetWorld()->GetMapName());
 	}	
 
-	CastChecked<AAtomGameState>(GameState)->RemainingTime = CountdownTime;
+	StartPhaseTimer(FMath::Max(CountdownTime, 1));
 	bFirstRoundInitialized = true;
 }
 
@@ -434,17 +520,19 @@ void AAtomGameMode::HandleMatchEnteredIntermission()
 		(*Iterator)->SetCinematicMode(true, false, false, true, false);
 	}
 
-	CastChecked<AAtomGameState>(GameState)->RemainingTime = IntermissionTime;
+	StartPhaseTimer(FMath::Max(IntermissionTime, 1));
 }
 
 void AAtomGameMode::HandleMatchLeavingIntermission()
 {
-	// Destroy pawns. They will be recreated next round.
-	// #AtomTodo Iterating controller list to destroy pawns. Investigate pawns not added to world for remotes for some reason.
+	SCOPE_CYCLE_COUNTER(STAT_ResetPlayersForRound);
+
+	// Reset pawns in place. Pawns that can't be reused are destroyed and will be recreated next round.
+	// #AtomTodo Iterating controller list to reset pawns. Investigate pawns not added to world for remotes for some reason.
 	for (FConstControllerIterator Iterator = GetWorld()->GetControllerIterator(); Iterator; ++Iterator)
 	{
 		AController* Controller = Iterator->Get();
-		if (Controller->GetPawn())
+		if (Controller->GetPawn() && !ResetPlayerForRound(Controller))
 		{
 			Controller->GetPawn()->Destroy();
 		}
@@ -454,6 +542,24 @@ void AAtomGameMode::HandleMatchLeavingIntermission()
 	SetMatchState(MatchState::Countdown);
 }
 
+bool AAtomGameMode::ResetPlayerForRound(AController* Controller)
+{
+	AAtomCharacter* const Character = Cast<AAtomCharacter>(Controller->GetPawn());
+
+	// Full spawns are only needed when the character class changes
+	if (Character == nullptr || Character->IsDying() || Character->GetClass() != GetDefaultPawnClassForController(Controller))
+		return false;
+
+	AActor* const StartSpot = FindPlayerStart(Controller);
+	if (StartSpot == nullptr)
+		return false;
+
+	Controller->StartSpot = StartSpot;
+	Character->ResetForRound(StartSpot->GetActorLocation(), StartSpot->GetActorRotation());
+
+	return true;
+}
+
 void AAtomGameMode::CheckForGameWinner_Implementation(AAtomPlayerState* Scorer)
 {
 	if (ScoreLimit > 0)
@@ -467,52 +573,114 @@ void AAtomGameMode::CheckForGameWinner_Implementation(AAtomPlayerState* Scorer)
 
 AActor* AAtomGameMode::ChoosePlayerStart_Implementation(AController* Player)
 {
-	// Choose a player start
-	APlayerStart* FoundPlayerStart = nullptr;
-	UClass* PawnClass = GetDefaultPawnClassForController(Player);
-	APawn* PawnToFit = PawnClass ? PawnClass->GetDefaultObject<APawn>() : nullptr;
+	SCOPE_CYCLE_COUNTER(STAT_ChoosePlayerStart);
 
-	TArray<APlayerStart*> UnOccupiedStartPoints;
-	TArray<APlayerStart*> OccupiedStartPoints;
-	
-	for (TActorIterator<APlayerStart> It(GetWorld()); It; ++It)
-	{
-		APlayerStart* PlayerStart = *It;
+	UWorld* const World = GetWorld();
 
-		if (PlayerStart->IsA<APlayerStartPIE>())
+#if WITH_EDITOR
+	if (World->IsPlayInEditor())
+	{
+		// Always prefer the "Play from Here" PlayerStart, if we find one while in PIE mode
+		TActorIterator<APlayerStartPIE> It(World);
+		if (It)
 		{
-			// Always prefer the first "Play from Here" PlayerStart, if we find one while in PIE mode
-			FoundPlayerStart = PlayerStart;
-			break;
+			return *It;
 		}
-		else if(IsValidPlayerStart(Player, PlayerStart))
+	}
+#endif
+
+	const int32 PlayerTeam = GetPlayerStartTeam(Player);
+	const TArray<int32>* TeamStarts = PlayerStartsByTeam.Find(PlayerTeam);
+
+	if (TeamStarts == nullptr || TeamStarts->Num() == 0)
+		return Super::ChoosePlayerStart_Implementation(Player);
+
+	// Gather pawns once instead of per start
+	PawnLocations.Reset();
+	EnemyLocations.Reset();
+
+	for (FConstControllerIterator It = World->GetControllerIterator(); It; ++It)
+	{
+		AController* const Other = It->Get();
+		APawn* const OtherPawn = Other ? Other->GetPawn() : nullptr;
+
+		if (OtherPawn && Other != Player)
 		{
-			FVector ActorLocation = PlayerStart->GetActorLocation();
-			const FRotator ActorRotation = PlayerStart->GetActorRotation();
-			if (!GetWorld()->EncroachingBlockingGeometry(PawnToFit, ActorLocation, ActorRotation))
-			{
-				UnOccupiedStartPoints.Add(PlayerStart);
-			}
-			else if (GetWorld()->FindTeleportSpot(PawnToFit, ActorLocation, ActorRotation))
+			PawnLocations.Add(OtherPawn->GetActorLocation());
+
+			if (PlayerTeam == INDEX_NONE || GetPlayerStartTeam(Other) != PlayerTeam)
 			{
-				OccupiedStartPoints.Add(PlayerStart);
+				EnemyLocations.Add(OtherPawn->GetActorLocation());
 			}
 		}
 	}
 
-	if (FoundPlayerStart == nullptr)
+	// Score free starts by distance to the nearest enemy. Starts are free when not reserved by another player and
+	// no other pawn is standing on them.
+	const float CurrentTime = World->GetTimeSeconds();
+	const float OccupiedRadiusSq = FMath::Square(SpawnOccupiedRadius);
+
+	int32 BestIndex = INDEX_NONE;
+	float BestScore = -1.f;
+	int32 NumBest = 0;
+	int32 FallbackIndex = INDEX_NONE;
+
+	for (int32 Index : *TeamStarts)
 	{
-		if (UnOccupiedStartPoints.Num() > 0)
+		const FCachedPlayerStart& Cached = CachedPlayerStarts[Index];
+		APlayerStart* const PlayerStart = Cached.PlayerStart.Get();
+		if (PlayerStart == nullptr)
+			continue;
+
+		// Least recently reserved start is used if no start is free
+		if (FallbackIndex == INDEX_NONE || Cached.ReservedUntil < CachedPlayerStarts[FallbackIndex].ReservedUntil)
 		{
-			FoundPlayerStart = UnOccupiedStartPoints[FMath::RandRange(0, UnOccupiedStartPoints.Num() - 1)];
+			FallbackIndex = Index;
 		}
-		else if (OccupiedStartPoints.Num() > 0)
+
+		const FVector StartLocation = PlayerStart->GetActorLocation();
+		AController* const ReservedBy = Cached.ReservedBy.Get();
+
+		if (ReservedBy && ReservedBy != Player && Cached.ReservedUntil > CurrentTime)
+			continue;
+
+		const bool bIsOccupied = PawnLocations.ContainsByPredicate([&StartLocation, OccupiedRadiusSq](const FVector& PawnLocation)
+		{
+			return FVector::DistSquared(PawnLocation, StartLocation) < OccupiedRadiusSq;
+		});
+
+		if (bIsOccupied)
+			continue;
+
+		float Score = MAX_flt;
+		for (const FVector& EnemyLocation : EnemyLocations)
+		{
+			Score = FMath::Min(Score, FVector::DistSquared(EnemyLocation, StartLocation));
+		}
+
+		if (Score > BestScore)
+		{
+			BestIndex = Index;
+			BestScore = Score;
+			NumBest = 1;
+		}
+		else if (Score == BestScore && FMath::RandRange(0, NumBest++) == 0)
 		{
-			FoundPlayerStart = OccupiedStartPoints[FMath::RandRange(0, OccupiedStartPoints.Num() - 1)];
+			// Random pick between equally scored starts, i.e. all starts when there are no enemies
+			BestIndex = Index;
 		}
 	}
 
-	return FoundPlayerStart != nullptr ? FoundPlayerStart : Super::ChoosePlayerStart_Implementation(Player);
+	const int32 ChosenIndex = (BestIndex != INDEX_NONE) ? BestIndex : FallbackIndex;
+	if (ChosenIndex == INDEX_NONE)
+		return Super::ChoosePlayerStart_Implementation(Player);
+
+	// Reserve so players restarting in the same frame spawn at different starts
+	FCachedPlayerStart& Chosen = CachedPlayerStarts[ChosenIndex];
+	Chosen.ReservedBy = Player;
+	Chosen.ReservedUntil = CurrentTime + SpawnReservationTime;
+
+	return Chosen.PlayerStart.Get();
 }
 
 bool AAtomGameMode::IsMatchInProgress() const
@@ -30,12 +30,20 @@ AAtomPlayerState* AAtomGameState::GetGameWinner() const
 	return GameWinner;
 }
 
+void AAtomGameState::SetPhaseDuration(float Duration)
+{
+	PhaseEndTime = (Duration > 0.f) ? GetServerWorldTimeSeconds() + Duration : 0.f;
+	RemainingTime = FMath::CeilToInt(GetRemainingTime());
+}
+
+float AAtomGameState::GetRemainingTime() const
+{
+	return (PhaseEndTime > 0.f) ? FMath::Max(PhaseEndTime - GetServerWorldTimeSeconds(), 0.f) : 0.f;
+}
+
 void AAtomGameState::DefaultTimer()
 {
-	if (MatchState == MatchState::InProgress || MatchState == MatchState::Intermission || MatchState == MatchState::Countdown)
-	{
-		--RemainingTime;
-	}
+	RemainingTime = FMath::CeilToInt(GetRemainingTime());
 
 	Super::DefaultTimer();
 }
@@ -47,7 +55,7 @@ void AAtomGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLi
 	DOREPLIFETIME(AAtomGameState, Teams);
 	DOREPLIFETIME(AAtomGameState, GameWinner);
 	DOREPLIFETIME(AAtomGameState, CurrentRound);
-	DOREPLIFETIME(AAtomGameState, RemainingTime);
+	DOREPLIFETIME(AAtomGameState, PhaseEndTime);
 
 	DOREPLIFETIME_CONDITION(AAtomGameState, bIsTeamGame, COND_InitialOnly);
 	DOREPLIFETIME_CONDITION(AAtomGameState, ScoreLimit, COND_InitialOnly);
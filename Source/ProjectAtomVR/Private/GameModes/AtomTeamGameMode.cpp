@@ -5,7 +5,6 @@
 #include "AtomTeamInfo.h"
 #include "Color.h"
 #include "AtomPlayerState.h"
-#include "AtomTeamStart.h"
 
 
 DEFINE_LOG_CATEGORY_STATIC(LogAtomTeamGameMode, Log, All);
@@ -183,6 +182,12 @@ void AAtomTeamGameMode::Logout(AController* Exiting)
 		}
 	}
 
+	if (auto PlayerController = Cast<APlayerController>(Exiting))
+	{
+		MuteListTeams.Remove(PlayerController);
+		PendingMuteListPlayers.Remove(PlayerController);
+	}
+
 	Super::Logout(Exiting);
 }
 
@@ -238,7 +243,6 @@ void AAtomTeamGameMode::UpdateGameplayMuteList(APlayerController* aPlayer)
 	if (bNoGameplayMute || !bMuteTeams)
 		return;
 
-	// Mute opposing teams and unmute team
 	AAtomPlayerState* const AtomPlayerState = Cast<AAtomPlayerState>(aPlayer->PlayerState);
 	
 	int32 TeamId = AAtomTeamInfo::INDEX_NO_TEAM;
@@ -247,45 +251,105 @@ void AAtomTeamGameMode::UpdateGameplayMuteList(APlayerController* aPlayer)
 		TeamId = AtomPlayerState->GetTeam()->TeamId;
 	}
 
-	const auto& PlayerNetId = aPlayer->PlayerState->UniqueId;
-	
 	auto& Teams = CastChecked<AAtomGameState>(GameState)->Teams;
-	for (int32 i = 0; i < Teams.Num(); ++i)
+	const int32* const MutedTeamId = MuteListTeams.Find(aPlayer);
+
+	if (MutedTeamId == nullptr)
 	{
-		if (i != TeamId)
+		// First update for this player. Mute opposing teams and unmute team, the controller may carry mutes 
+		// over from a previous map.
+		for (int32 i = 0; i < Teams.Num(); ++i)
 		{
-			for (auto& Controller : Teams[i]->GetTeamMembers())
-			{				
-				if (auto PlayerController = Cast<APlayerController>(Controller))
-				{
-					const auto& OtherNetId = PlayerController->PlayerState->UniqueId;
-					if (OtherNetId.IsValid())
-					{
-						aPlayer->GameplayMutePlayer(OtherNetId);
-						PlayerController->GameplayMutePlayer(PlayerNetId);
-					}
-				}
+			SetTeamGameplayMuted(aPlayer, Teams[i], i != TeamId);
+		}
+	}
+	else if (*MutedTeamId != TeamId)
+	{
+		// Team changed. Only pairs with the old and new team flip, all other teams remain muted.
+		if (Teams.IsValidIndex(*MutedTeamId))
+		{
+			SetTeamGameplayMuted(aPlayer, Teams[*MutedTeamId], true);
+		}
 
-			}
+		if (Teams.IsValidIndex(TeamId))
+		{
+			SetTeamGameplayMuted(aPlayer, Teams[TeamId], false);
 		}
-		else
+	}
+
+	MuteListTeams.Add(aPlayer, TeamId);
+}
+
+void AAtomTeamGameMode::SetTeamGameplayMuted(APlayerController* aPlayer, AAtomTeamInfo* Team, bool bMuted)
+{
+	const auto& PlayerNetId = aPlayer->PlayerState->UniqueId;
+
+	if (!PlayerNetId.IsValid())
+	{
+		PendingMuteListPlayers.AddUnique(aPlayer);
+		return;
+	}
+
+	for (auto& Controller : Team->GetTeamMembers())
+	{
+		if (Controller == aPlayer)
+			continue;
+
+		if (auto PlayerController = Cast<APlayerController>(Controller))
 		{
-			for (auto& Controller : Teams[i]->GetTeamMembers())
+			const auto& OtherNetId = PlayerController->PlayerState->UniqueId;
+			if (!OtherNetId.IsValid())
+			{
+				// The other player's own update covers this pair once its UniqueId is valid
+				PendingMuteListPlayers.AddUnique(PlayerController);
+			}
+			else if (bMuted)
 			{
-				if (Controller == aPlayer)
-					continue;
-
-				if (auto PlayerController = Cast<APlayerController>(Controller))
-				{
-					const auto& OtherNetId = PlayerController->PlayerState->UniqueId;
-					if (OtherNetId.IsValid())
-					{
-						aPlayer->GameplayUnmutePlayer(OtherNetId);
-						PlayerController->GameplayUnmutePlayer(PlayerNetId);
-					}
-				}
+				aPlayer->GameplayMutePlayer(OtherNetId);
+				PlayerController->GameplayMutePlayer(PlayerNetId);
 			}
+			else
+			{
+				aPlayer->GameplayUnmutePlayer(OtherNetId);
+				PlayerController->GameplayUnmutePlayer(PlayerNetId);
+			}
+		}
+	}
+}
+
+void AAtomTeamGameMode::UpdatePendingMuteLists()
+{
+	TArray<APlayerController*, TInlineAllocator<8>> ReadyPlayers;
+
+	for (int32 i = PendingMuteListPlayers.Num() - 1; i >= 0; --i)
+	{
+		APlayerController* const PlayerController = PendingMuteListPlayers[i].Get();
+		if (PlayerController == nullptr || PlayerController->PlayerState == nullptr)
+		{
+			PendingMuteListPlayers.RemoveAtSwap(i);
 		}
+		else if (PlayerController->PlayerState->UniqueId.IsValid())
+		{
+			ReadyPlayers.Add(PlayerController);
+			PendingMuteListPlayers.RemoveAtSwap(i);
+		}
+	}
+
+	for (APlayerController* PlayerController : ReadyPlayers)
+	{
+		// A full update sets every pair with this player, including the ones skipped before
+		MuteListTeams.Remove(PlayerController);
+		UpdateGameplayMuteList(PlayerController);
+	}
+}
+
+void AAtomTeamGameMode::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (PendingMuteListPlayers.Num() > 0)
+	{
+		UpdatePendingMuteLists();
 	}
 }
 
@@ -323,12 +387,12 @@ void AAtomTeamGameMode::ApplyPlaylistSettings(const FPlaylistItem& Playlist)
 	TeamColors = Playlist.TeamColors;
 }
 
-bool AAtomTeamGameMode::IsValidPlayerStart(AController* Player, APlayerStart* PlayerStart)
+int32 AAtomTeamGameMode::GetPlayerStartTeam(AController* Player) const
 {
-	AAtomPlayerState* AtomPlayerState = Cast<AAtomPlayerState>(Player->PlayerState);
-	AAtomTeamStart* AtomTeamStart = Cast<AAtomTeamStart>(PlayerStart);
+	AAtomPlayerState* AtomPlayerState = Player ? Cast<AAtomPlayerState>(Player->PlayerState) : nullptr;
+	AAtomTeamInfo* Team = AtomPlayerState ? AtomPlayerState->GetTeam() : nullptr;
 
-	return !AtomPlayerState || (AtomTeamStart && (AtomPlayerState->GetTeam()->TeamId == AtomTeamStart->TeamId));
+	return Team ? Team->TeamId : INDEX_NONE;
 }
 
 void AAtomTeamGameMode::CheckForGameWinner_Implementation(AAtomPlayerState* Scorer)
@@ -11,6 +11,8 @@
 #include "ControlPointPlayerState.h"
 #include "AtomObjectiveMessage.h"
 
+DECLARE_CYCLE_STAT(TEXT("ControlPoint Score Accrual"), STAT_ControlPointScoreAccrual, STATGROUP_ProjectAtom);
+
 AControlPointGameMode::AControlPointGameMode()
 {
 	GameStateClass = AControlPointGameState::StaticClass();
@@ -39,22 +41,38 @@ void AControlPointGameMode::OnControlPointCaptured()
 	}
 }
 
-void AControlPointGameMode::DefaultTimer()
+void AControlPointGameMode::Tick(float DeltaSeconds)
 {
+	SCOPE_CYCLE_COUNTER(STAT_ControlPointScoreAccrual);
+
 	check(Cast<AControlPointGameState>(GameState));
 
-	// Add capture score to controlling team
+	// Accrue capture score to controlling team. Fractions carry over so score matches the time held.
+	AAtomTeamInfo* ControllingTeam = nullptr;
+
 	if (MatchState == MatchState::InProgress)
 	{
 		auto CPGameState = CastChecked<AControlPointGameState>(GameState);
-		if (auto ControlPoint = CPGameState->GetActiveControlPoint())
+		auto ControlPoint = CPGameState->GetActiveControlPoint();
+
+		if (ControlPoint && ControlPoint->IsCaptured())
 		{
-			if (ControlPoint->IsCaptured())
+			ControllingTeam = ControlPoint->GetControllingTeam();
+			check(ControllingTeam);
+
+			if (AccruingTeam != ControllingTeam)
 			{
-				AAtomTeamInfo* ControllingTeam = ControlPoint->GetControllingTeam();
-				check(ControllingTeam);
+				AccruingTeam = ControllingTeam;
+				AccruedControlScore = 0.f;
+			}
+
+			AccruedControlScore += DeltaSeconds * ControlScoreRate;
 
-				ControllingTeam->Score += ControlScoreRate;
+			const int32 WholeScore = FMath::FloorToInt(AccruedControlScore);
+			if (WholeScore > 0)
+			{
+				AccruedControlScore -= WholeScore;
+				ControllingTeam->Score += WholeScore;
 
 				if (ControllingTeam->Score >= ScoreLimit)
 				{
@@ -64,7 +82,13 @@ void AControlPointGameMode::DefaultTimer()
 		}
 	}
 
-	Super::DefaultTimer();
+	if (ControllingTeam == nullptr)
+	{
+		AccruingTeam = nullptr;
+		AccruedControlScore = 0.f;
+	}
+
+	Super::Tick(DeltaSeconds);
 }
 
 void AControlPointGameMode::InitGameStateForRound(AAtomGameState* InGameState)
@@ -164,10 +188,8 @@ void AControlPointGameMode::ScoreKill_Implementation(AAtomPlayerState* Killer, A
 
 	if (ControlPoint && CPPlayerState)
 	{
-		UPrimitiveComponent* CaptureBounds = ControlPoint->GetCaptureBounds();
-
-		if (CaptureBounds->IsOverlappingActor(CPPlayerState->GetAtomCharacter()) ||
-			CaptureBounds->IsOverlappingActor(Victim->GetAtomCharacter()))
+		if (ControlPoint->IsCharacterPresent(CPPlayerState->GetAtomCharacter()) ||
+			ControlPoint->IsCharacterPresent(Victim->GetAtomCharacter()))
 		{
 			check(CPPlayerState->GetTeam());
 
@@ -190,6 +212,18 @@ void AControlPointGameMode::ScoreKill_Implementation(AAtomPlayerState* Killer, A
 	Super::ScoreKill_Implementation(Killer, Victim);
 }
 
+void AControlPointGameMode::ScoreDeath_Implementation(AAtomPlayerState* Killer, AAtomPlayerState* Victim)
+{
+	// Dead characters no longer hold the point. Done here as ragdolls may stay within the capture bounds.
+	auto ControlPointGameState = CastChecked<AControlPointGameState>(GameState);
+	if (AAtomControlPoint* ControlPoint = ControlPointGameState->GetActiveControlPoint())
+	{
+		ControlPoint->RemovePresence(Victim->GetAtomCharacter());
+	}
+
+	Super::ScoreDeath_Implementation(Killer, Victim);
+}
+
 void AControlPointGameMode::OnObjectiveInitialized(class AAtomGameObjective* Objective)
 {
 	Super::OnObjectiveInitialized(Objective);
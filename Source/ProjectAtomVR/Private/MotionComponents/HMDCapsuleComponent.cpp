@@ -13,6 +13,8 @@
 
 DEFINE_LOG_CATEGORY_STATIC(LogHMDCapsule, Log, All);
 
+DECLARE_CYCLE_STAT(TEXT("HMDCapsule UpdateCollisionOffset"), STAT_HMDCapsuleUpdateCollisionOffset, STATGROUP_ProjectAtom);
+
 UHMDCapsuleComponent::UHMDCapsuleComponent(const FObjectInitializer& ObjectInitializer /*= FObjectInitializer::Get()*/)
 	: Super(ObjectInitializer)
 {
@@ -71,9 +73,20 @@ void UHMDCapsuleComponent::InitializeComponent()
 
 void UHMDCapsuleComponent::UpdateCollisionOffset()
 {
+	SCOPE_CYCLE_COUNTER(STAT_HMDCapsuleUpdateCollisionOffset);
+
 	// Use the location of the base of the neck to offset the collision
 	const FVector RelativeNeckBase = ComponentToWorld.InverseTransformPosition(Camera->GetWorldNeckBaseLocation());
 
+	// Adjust capsule height if needed.
+	const float HeadCenterZOffset = Camera->GetWorldHeadLocation().Z - GetComponentLocation().Z;
+	const float PerfectCapsuleHalfHeight = (HeadCenterZOffset + CapsuleHeightPadding) / 2.f;
+	const bool bIsHeightChanged = FMath::Abs(PerfectCapsuleHalfHeight - GetUnscaledCapsuleHalfHeight()) > MaxCapsuleHeightError;
+
+	// Nothing to sweep or rebuild until the head moves past the tolerance.
+	if (!bIsHeightChanged && (RelativeNeckBase - CollisionOffset).SizeSquared2D() < FMath::Square(CollisionOffsetTolerance))
+		return;
+
 	// First sweep to the new location to determine if we need to move the component location to offset
 	// any new collision from moving the HMD.
 	if(GetOwner()->Role > ENetRole::ROLE_SimulatedProxy)
@@ -112,20 +125,13 @@ void UHMDCapsuleComponent::UpdateCollisionOffset()
 		}
 	}
 
-	// Adjust capsule height if needed.
-	constexpr float MaxCapsuleHeightError = 5.0f; // Max difference between HMD height and capsule height allowed
-	constexpr float CapsuleHeightPadding = 25.f;  // Height padding applied to capsule in addition to HMD height
-
-	const float HeadCenterZOffset = Camera->GetWorldHeadLocation().Z - GetComponentLocation().Z;
-	const float PerfectCapsuleHalfHeight = (HeadCenterZOffset + CapsuleHeightPadding) / 2.f;
-
-	if (FMath::Abs(PerfectCapsuleHalfHeight - GetUnscaledCapsuleHalfHeight()) > MaxCapsuleHeightError)
+	if (bIsHeightChanged)
 	{
 		CapsuleHalfHeight = PerfectCapsuleHalfHeight;
 	}	
 
 	// Center capsule on player head in XY and place base at negative HMD height
-	CollisionOffset = FVector{ RelativeNeckBase.X, RelativeNeckBase.Y, GetUnscaledCapsuleHalfHeight() };;
+	CollisionOffset = FVector{ RelativeNeckBase.X, RelativeNeckBase.Y, GetUnscaledCapsuleHalfHeight() };
 
 	// Update collision
 	UpdateBounds();
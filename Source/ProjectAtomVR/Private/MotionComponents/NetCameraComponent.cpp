@@ -3,12 +3,6 @@
 #include "ProjectAtomVR.h"
 #include "NetCameraComponent.h"
 
-namespace
-{
-	static FVector SavedLocation = FVector::ZeroVector;
-	static FRotator SavedRotation = FRotator::ZeroRotator;
-}
-
 UNetCameraComponent::UNetCameraComponent(const FObjectInitializer& ObjectInitializer /*= FObjectInitializer::Get()*/)
 	: Super(ObjectInitializer)
 {
@@ -17,9 +11,18 @@ UNetCameraComponent::UNetCameraComponent(const FObjectInitializer& ObjectInitial
 	PrimaryComponentTick.TickGroup = TG_PrePhysics;
 }
 
-void UNetCameraComponent::ServerSendTransform_Implementation(const FVector_NetQuantize10 Location, const FRotator Rotation)
+bool UNetCameraComponent::SetNetTransform(const FVector& Location, const FRotator& Rotation, float TimeStamp, bool bForceUpdate /*= false*/)
 {
-	SetRelativeLocationAndRotation(Location, Rotation);
+	const bool bIsApplied = !IsWithinNetDeadBand(RelativeLocation, RelativeRotation, Location, Rotation, NetLocationDeadBand, NetRotationDeadBand);
+	if (bIsApplied)
+	{
+		SetRelativeLocationAndRotation(Location, Rotation);
+		NetTimeStamp = TimeStamp;
+	}
+	else if (!bForceUpdate)
+	{
+		return false;
+	}
 
 	const float CurrentTime = GetWorld()->GetRealTimeSeconds();
 	const float DeltaTime = CurrentTime - LastNetUpdate;
@@ -30,42 +33,62 @@ void UNetCameraComponent::ServerSendTransform_Implementation(const FVector_NetQu
 		OnPostNetTransformUpdate.ExecuteIfBound(CurrentTime - LastNetUpdate);
 		LastNetUpdate = CurrentTime;
 	}
+
+	return bIsApplied;
 }
 
-bool UNetCameraComponent::ServerSendTransform_Validate(const FVector_NetQuantize10 Location, const FRotator Rotation)
+bool UNetCameraComponent::IsInterpolatingNetTransform() const
 {
-	return true;
+	return InterpolationDelay > 0.f && GetOwnerRole() == ROLE_SimulatedProxy;
 }
 
 void UNetCameraComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	bool bIsControlled = false;
-
-	if (IsInGameThread())
+	if (IsInterpolatingNetTransform())
 	{
-		const APawn* MyPawn = Cast<APawn>(GetOwner());
-		bIsControlled = MyPawn ? MyPawn->IsLocallyControlled() : false;
+		FVector Location;
+		FRotator Rotation;
+		const float SampleTime = FNetTransformBuffer::GetServerTime(GetWorld()) - InterpolationDelay;
+		if (NetTransformBuffer.Sample(SampleTime, MaxExtrapolationTime, Location, Rotation))
+		{
+			SetRelativeLocationAndRotation(Location, Rotation);
+		}
 	}
-
-	if (bIsControlled && GetIsReplicated() && !GetOwner()->HasAuthority())
+	else if (GetOwnerRole() == ROLE_Authority && IsLocallyControlledOwner())
 	{
-		const float CurrentTime = GetWorld()->GetRealTimeSeconds();
-		if (CurrentTime - LastNetUpdate > 1.f / NetUpdateFrequency)
-		{			
-			ServerSendTransform(RelativeLocation, RelativeRotation);
-			LastNetUpdate = CurrentTime;
-		}
+		// Listen server devices are tracked locally, so they are captured at the current server time
+		NetTimeStamp = GetWorld()->GetTimeSeconds();
 	}
 }
 
+bool UNetCameraComponent::IsLocallyControlledOwner() const
+{
+	const APawn* const Pawn = Cast<APawn>(GetOwner());
+	return Pawn && Pawn->IsLocallyControlled();
+}
+
 void UNetCameraComponent::PostNetReceive()
 {
 	Super::PostNetReceive();
 
-	// Check if transform was updated
-	if (SavedLocation != RelativeLocation || SavedRotation != RelativeRotation)
+	const bool bIsUpdated = !IsWithinNetDeadBand(SavedLocation, SavedRotation, RelativeLocation, RelativeRotation, 
+		NetLocationDeadBand, NetRotationDeadBand);
+
+	if (IsInterpolatingNetTransform())
+	{
+		// Buffer the new transform at the time it was captured and keep playing back the current one. The owner
+		// is responsible for updating anything that depends on the interpolated transform.
+		if (bIsUpdated)
+		{
+			NetTransformBuffer.AddSnapshot(NetTimeStamp, RelativeLocation, RelativeRotation);
+		}
+
+		RelativeLocation = SavedLocation;
+		RelativeRotation = SavedRotation;
+	}
+	else if (bIsUpdated)
 	{
 		const float CurrentTime = GetWorld()->GetRealTimeSeconds();
 		OnPostNetTransformUpdate.ExecuteIfBound(CurrentTime - LastNetUpdate);
@@ -89,4 +112,5 @@ void UNetCameraComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 	DOREPLIFETIME_CHANGE_CONDITION(USceneComponent, RelativeLocation, COND_SimulatedOnly);
 	DOREPLIFETIME_CHANGE_CONDITION(USceneComponent, RelativeRotation, COND_SimulatedOnly);
 	DOREPLIFETIME_CHANGE_CONDITION(USceneComponent, RelativeScale3D, COND_SimulatedOnly);
+	DOREPLIFETIME_CONDITION(UNetCameraComponent, NetTimeStamp, COND_SimulatedOnly);
 }
@@ -12,32 +12,72 @@ void UNetMotionControllerComponent::GetLifetimeReplicatedProps(TArray<FLifetimeP
 	DOREPLIFETIME_CHANGE_CONDITION(USceneComponent, RelativeLocation, COND_SimulatedOnly);
 	DOREPLIFETIME_CHANGE_CONDITION(USceneComponent, RelativeRotation, COND_SimulatedOnly);
 	DOREPLIFETIME_CHANGE_CONDITION(USceneComponent, RelativeScale3D, COND_SimulatedOnly);
+	DOREPLIFETIME_CONDITION(UNetMotionControllerComponent, NetTimeStamp, COND_SimulatedOnly);
 }
 
-void UNetMotionControllerComponent::ServerSendTransform_Implementation(const FVector_NetQuantize10 Location, const FRotator Rotation)
+bool UNetMotionControllerComponent::SetNetTransform(const FVector& Location, const FRotator& Rotation, float TimeStamp)
 {
+	if (IsWithinNetDeadBand(RelativeLocation, RelativeRotation, Location, Rotation, NetLocationDeadBand, NetRotationDeadBand))
+		return false;
+
 	SetRelativeLocationAndRotation(Location, Rotation);
+	NetTimeStamp = TimeStamp;
+	return true;
 }
 
-bool UNetMotionControllerComponent::ServerSendTransform_Validate(const FVector_NetQuantize10 Location, const FRotator Rotation)
+bool UNetMotionControllerComponent::IsInterpolatingNetTransform() const
 {
-	return true;
+	return InterpolationDelay > 0.f && GetOwnerRole() == ROLE_SimulatedProxy;
 }
 
 void UNetMotionControllerComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (IsTracked() && GetIsReplicated() && !GetOwner()->HasAuthority())
+	if (IsInterpolatingNetTransform())
 	{
-		LastNetUpdate += DeltaTime;
+		FVector Location;
+		FRotator Rotation;
+		const float SampleTime = FNetTransformBuffer::GetServerTime(GetWorld()) - InterpolationDelay;
+		if (NetTransformBuffer.Sample(SampleTime, MaxExtrapolationTime, Location, Rotation))
+		{
+			SetRelativeLocationAndRotation(Location, Rotation);
+		}
+	}
+	else if (GetOwnerRole() == ROLE_Authority && IsLocallyControlledOwner())
+	{
+		// Listen server devices are tracked locally, so they are captured at the current server time
+		NetTimeStamp = GetWorld()->GetTimeSeconds();
+	}
+}
 
-		if (LastNetUpdate > 1.f / NetUpdateFrequency)
+bool UNetMotionControllerComponent::IsLocallyControlledOwner() const
+{
+	const APawn* const Pawn = Cast<APawn>(GetOwner());
+	return Pawn && Pawn->IsLocallyControlled();
+}
+
+void UNetMotionControllerComponent::PostNetReceive()
+{
+	Super::PostNetReceive();
+
+	if (IsInterpolatingNetTransform())
+	{
+		// Buffer the new transform at the time it was captured and keep playing back the current one
+		if (!IsWithinNetDeadBand(SavedLocation, SavedRotation, RelativeLocation, RelativeRotation, NetLocationDeadBand, NetRotationDeadBand))
 		{
-			LastNetUpdate = 0.f;
-			ServerSendTransform(RelativeLocation, RelativeRotation);
+			NetTransformBuffer.AddSnapshot(NetTimeStamp, RelativeLocation, RelativeRotation);
 		}
+
+		RelativeLocation = SavedLocation;
+		RelativeRotation = SavedRotation;
 	}
 }
 
+void UNetMotionControllerComponent::PreNetReceive()
+{
+	Super::PreNetReceive();
 
+	SavedLocation = RelativeLocation;
+	SavedRotation = RelativeRotation;
+}
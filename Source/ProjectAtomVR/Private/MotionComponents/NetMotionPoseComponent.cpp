@@ -0,0 +1,127 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#include "ProjectAtomVR.h"
+#include "NetMotionPoseComponent.h"
+
+#include "NetMotionControllerComponent.h"
+#include "HMDCameraComponent.h"
+#include "NetTransformBuffer.h"
+#include "AtomPlayerController.h"
+
+UNetMotionPoseComponent::UNetMotionPoseComponent(const FObjectInitializer& ObjectInitializer /*= FObjectInitializer::Get()*/)
+	: Super(ObjectInitializer)
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = true;
+	PrimaryComponentTick.TickGroup = TG_PrePhysics;
+
+	bReplicates = true;
+	bHasReceivedPose = false;
+}
+
+void UNetMotionPoseComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	Character = Cast<AAtomCharacter>(GetOwner());
+}
+
+void UNetMotionPoseComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (Character && Character->IsLocallyControlled() && !Character->HasAuthority())
+	{
+		const float CurrentTime = GetWorld()->GetRealTimeSeconds();
+		const float TimeSinceUpdate = CurrentTime - LastNetUpdate;
+		if (TimeSinceUpdate > 1.f / NetUpdateFrequency)
+		{
+			FMotionPoseRep Pose;
+			GatherPose(Pose);
+
+			if (TimeSinceUpdate > IdleResendInterval || HasPoseChanged(Pose))
+			{
+				Pose.Sequence = NextSequence++;
+
+				ServerSendPose(Pose);
+				LastSentPose = Pose;
+				LastNetUpdate = CurrentTime;
+			}
+		}
+	}
+}
+
+void UNetMotionPoseComponent::GatherPose(FMotionPoseRep& OutPose) const
+{
+	UHMDCameraComponent* const Camera = Character->GetCamera();
+	OutPose.Head.Location = Camera->RelativeLocation;
+	OutPose.Head.Rotation = Camera->RelativeRotation;
+
+	UNetMotionControllerComponent* const LeftHand = Character->GetHandController(EHand::Left);
+	OutPose.bIsLeftHandTracked = LeftHand->IsTracked();
+	OutPose.LeftHand.Location = LeftHand->RelativeLocation;
+	OutPose.LeftHand.Rotation = LeftHand->RelativeRotation;
+
+	UNetMotionControllerComponent* const RightHand = Character->GetHandController(EHand::Right);
+	OutPose.bIsRightHandTracked = RightHand->IsTracked();
+	OutPose.RightHand.Location = RightHand->RelativeLocation;
+	OutPose.RightHand.Rotation = RightHand->RelativeRotation;
+}
+
+bool UNetMotionPoseComponent::HasPoseChanged(const FMotionPoseRep& Pose) const
+{
+	if (Pose.bIsLeftHandTracked != LastSentPose.bIsLeftHandTracked || Pose.bIsRightHandTracked != LastSentPose.bIsRightHandTracked)
+		return true;
+
+	auto HasMoved = [this](const FMotionTransformRep& Current, const FMotionTransformRep& Last)
+	{
+		return !IsWithinNetDeadBand(Current.Location, Current.Rotation, Last.Location, Last.Rotation, LocationDeadBand, RotationDeadBand);
+	};
+
+	return HasMoved(Pose.Head, LastSentPose.Head) ||
+		(Pose.bIsLeftHandTracked && HasMoved(Pose.LeftHand, LastSentPose.LeftHand)) ||
+		(Pose.bIsRightHandTracked && HasMoved(Pose.RightHand, LastSentPose.RightHand));
+}
+
+void UNetMotionPoseComponent::ServerSendPose_Implementation(FMotionPoseRep Pose)
+{
+	if (!AAtomPlayerController::AllowServerRpc(GetOwner(), EServerRpcFamily::Pose))
+		return;
+
+	// Drop poses that arrived out of order
+	if (bHasReceivedPose && !Pose.IsNewerThan(LastReceivedSequence))
+		return;
+
+	LastReceivedSequence = Pose.Sequence;
+	bHasReceivedPose = true;
+
+	if (Character == nullptr)
+		return;
+
+	// The time stamp comes from the client, so keep it within the last MaxPoseAge seconds of server time and never
+	// behind the last applied pose. Simulated proxies interpolate on this timeline and expect it to increase.
+	const float ServerTime = GetWorld()->GetTimeSeconds();
+	const float TimeStamp = FMath::Max(FMath::Clamp(Pose.TimeStamp, ServerTime - MaxPoseAge, ServerTime), LastReceivedTimeStamp);
+	LastReceivedTimeStamp = TimeStamp;
+
+	// Hands are applied first so the body update triggered by the camera uses the new hand locations. The body
+	// faces between the hands, so it is updated if either hand moved even when the head did not.
+	bool bHasHandMoved = false;
+
+	if (Pose.bIsLeftHandTracked)
+	{
+		bHasHandMoved |= Character->GetHandController(EHand::Left)->SetNetTransform(Pose.LeftHand.Location, Pose.LeftHand.Rotation, TimeStamp);
+	}
+
+	if (Pose.bIsRightHandTracked)
+	{
+		bHasHandMoved |= Character->GetHandController(EHand::Right)->SetNetTransform(Pose.RightHand.Location, Pose.RightHand.Rotation, TimeStamp);
+	}
+
+	Character->GetCamera()->SetNetTransform(Pose.Head.Location, Pose.Head.Rotation, TimeStamp, bHasHandMoved);
+}
+
+bool UNetMotionPoseComponent::ServerSendPose_Validate(FMotionPoseRep Pose)
+{
+	return true;
+}
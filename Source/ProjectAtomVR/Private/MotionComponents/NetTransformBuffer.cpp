@@ -0,0 +1,86 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#include "ProjectAtomVR.h"
+#include "NetTransformBuffer.h"
+
+void FNetTransformBuffer::AddSnapshot(float Timestamp, const FVector& Location, const FRotator& Rotation)
+{
+	FSnapshot& Snapshot = Snapshots[Head];
+	Snapshot.Timestamp = Timestamp;
+	Snapshot.Location = Location;
+	Snapshot.Rotation = Rotation.Quaternion();
+
+	Head = (Head + 1) % Capacity;
+	Num = FMath::Min(Num + 1, Capacity);
+}
+
+bool FNetTransformBuffer::Sample(float Time, float MaxExtrapolation, FVector& OutLocation, FRotator& OutRotation) const
+{
+	if (Num == 0)
+		return false;
+
+	const FSnapshot& Newest = GetSnapshot(0);
+
+	if (Time >= Newest.Timestamp)
+	{
+		if (Num == 1 || MaxExtrapolation <= 0.f)
+		{
+			OutLocation = Newest.Location;
+			OutRotation = Newest.Rotation.Rotator();
+			return true;
+		}
+
+		// Extrapolate using the velocity between the two newest snapshots
+		const FSnapshot& Previous = GetSnapshot(1);
+		const float SnapshotDelta = Newest.Timestamp - Previous.Timestamp;
+		const float Alpha = (SnapshotDelta > KINDA_SMALL_NUMBER) ? FMath::Min(Time - Newest.Timestamp, MaxExtrapolation) / SnapshotDelta : 0.f;
+
+		OutLocation = Newest.Location + (Newest.Location - Previous.Location) * Alpha;
+
+		FVector DeltaAxis; float DeltaAngle;
+		(Newest.Rotation * Previous.Rotation.Inverse()).ToAxisAndAngle(DeltaAxis, DeltaAngle);
+		DeltaAngle = FMath::UnwindRadians(DeltaAngle);
+		OutRotation = (FQuat{ DeltaAxis, DeltaAngle * Alpha } * Newest.Rotation).Rotator();
+		return true;
+	}
+
+	// Find the snapshots surrounding the sample time
+	for (int32 Age = 1; Age < Num; ++Age)
+	{
+		const FSnapshot& Older = GetSnapshot(Age);
+		if (Older.Timestamp <= Time)
+		{
+			const FSnapshot& Newer = GetSnapshot(Age - 1);
+			const float SnapshotDelta = Newer.Timestamp - Older.Timestamp;
+			const float Alpha = (SnapshotDelta > KINDA_SMALL_NUMBER) ? (Time - Older.Timestamp) / SnapshotDelta : 1.f;
+
+			OutLocation = FMath::Lerp(Older.Location, Newer.Location, Alpha);
+			OutRotation = FQuat::Slerp(Older.Rotation, Newer.Rotation, Alpha).Rotator();
+			return true;
+		}
+	}
+
+	// Sample time is older than the buffer, hold the oldest snapshot
+	const FSnapshot& Oldest = GetSnapshot(Num - 1);
+	OutLocation = Oldest.Location;
+	OutRotation = Oldest.Rotation.Rotator();
+	return true;
+}
+
+void FNetTransformBuffer::Reset()
+{
+	Head = 0;
+	Num = 0;
+}
+
+float FNetTransformBuffer::GetServerTime(const UWorld* World)
+{
+	const AGameStateBase* const GameState = World->GetGameState();
+	return GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+const FNetTransformBuffer::FSnapshot& FNetTransformBuffer::GetSnapshot(int32 Age) const
+{
+	check(Age < Num);
+	return Snapshots[(Head - 1 - Age + Capacity) % Capacity];
+}
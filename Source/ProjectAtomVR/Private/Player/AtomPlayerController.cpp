@@ -10,9 +10,32 @@
 #include "AtomPlayerState.h"
 #include "AtomTeamInfo.h"
 #include "Engine/World.h"
+#include "GameFramework/GameSession.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogAtomPlayerController, Log, All);
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Rejected Server RPCs"), STAT_RejectedServerRpcs, STATGROUP_ProjectAtom);
+
+namespace
+{
+	const TCHAR* const ServerRpcFamilyNames[] = { TEXT("Fire"), TEXT("Ammo"), TEXT("Equip"), TEXT("Pose") };
+	static_assert(ARRAY_COUNT(ServerRpcFamilyNames) == static_cast<uint8>(EServerRpcFamily::MAX_COUNT), "Missing RPC family name");
+}
+
+static FAutoConsoleCommandWithWorld DumpRejectedRpcsCommand(
+	TEXT("s.DumpRejectedRpcs"),
+	TEXT("Logs rejected server RPC counts for each player"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		{
+			if (const AAtomPlayerController* const PC = Cast<AAtomPlayerController>(*It))
+			{
+				PC->DumpRejectedRpcs();
+			}
+		}
+	}));
+
 AAtomPlayerController::AAtomPlayerController()
 {
 	// Add camera to be used with HMD while inactive/dead
@@ -22,6 +45,15 @@ AAtomPlayerController::AAtomPlayerController()
 	Camera->SetupAttachment(RootComponent);
 
 	bAttachToPawn = true;
+
+	FireRpcRateLimit.TokensPerSecond = 20.f;
+	FireRpcRateLimit.BurstSize = 10.f;
+
+	// Poses are sent every frame
+	PoseRpcRateLimit.TokensPerSecond = 150.f;
+	PoseRpcRateLimit.BurstSize = 30.f;
+
+	bIsKickedForInvalidRpcs = false;
 }
 
 void AAtomPlayerController::execChangeTeams()
@@ -394,3 +426,89 @@ void AAtomPlayerController::SpawnDefaultHUD()
 	VRHUD = GetWorld()->SpawnActor<AVRHUD>(SpawnInfo);
 }
 
+AAtomPlayerController* AAtomPlayerController::GetRemoteOwningController(const AActor* Actor)
+{
+	UPlayer* const Player = Actor ? Actor->GetNetOwningPlayer() : nullptr;
+	AAtomPlayerController* const PC = Player ? Cast<AAtomPlayerController>(Player->PlayerController) : nullptr;
+
+	return (PC && !PC->IsLocalController()) ? PC : nullptr;
+}
+
+bool AAtomPlayerController::AllowServerRpc(const AActor* Caller, EServerRpcFamily Family, float Cost /*= 1.f*/)
+{
+	check(Family == EServerRpcFamily::Fire || Family == EServerRpcFamily::Pose);
+
+	AAtomPlayerController* const PC = GetRemoteOwningController(Caller);
+	if (PC == nullptr)
+		return true;
+
+	FTokenBucket& Bucket = PC->RpcBuckets[static_cast<uint8>(Family)];
+	if (Bucket.TryConsume(PC->GetWorld()->GetRealTimeSeconds(), PC->GetRpcRateLimit(Family), Cost))
+		return true;
+
+	PC->OnServerRpcRejected(Family, TEXT("Rate limited"));
+	return false;
+}
+
+void AAtomPlayerController::RejectServerRpc(const AActor* Caller, EServerRpcFamily Family, const TCHAR* Reason)
+{
+	if (AAtomPlayerController* const PC = GetRemoteOwningController(Caller))
+	{
+		PC->OnServerRpcRejected(Family, Reason);
+	}
+}
+
+const FRpcRateLimit& AAtomPlayerController::GetRpcRateLimit(EServerRpcFamily Family) const
+{
+	switch (Family)
+	{
+	case EServerRpcFamily::Fire:
+		return FireRpcRateLimit;
+	default:
+		return PoseRpcRateLimit;
+	}
+}
+
+void AAtomPlayerController::OnServerRpcRejected(EServerRpcFamily Family, const TCHAR* Reason)
+{
+	uint32& RejectedCount = RejectedRpcCounts[static_cast<uint8>(Family)];
+	++RejectedCount;
+	INC_DWORD_STAT(STAT_RejectedServerRpcs);
+
+	// Only the first rejection for a family is a warning, repeats are expected while a limit is being hit
+	UE_CLOG(RejectedCount > 1, LogAtomPlayerController, Verbose, TEXT("Rejected %s RPC from %s: %s"), ServerRpcFamilyNames[static_cast<uint8>(Family)], *GetNameSafe(PlayerState), Reason);
+	UE_CLOG(RejectedCount == 1, LogAtomPlayerController, Warning, TEXT("Rejected %s RPC from %s: %s"), ServerRpcFamilyNames[static_cast<uint8>(Family)], *GetNameSafe(PlayerState), Reason);
+
+	if (InvalidRpcAction != EInvalidRpcAction::Kick || bIsKickedForInvalidRpcs)
+		return;
+
+	const float CurrentTime = GetWorld()->GetRealTimeSeconds();
+	if (CurrentTime - RecentRejectionsStartTime > KickRejectionWindow)
+	{
+		RecentRejections = 0;
+		RecentRejectionsStartTime = CurrentTime;
+	}
+
+	if (++RecentRejections > KickRejectionThreshold)
+	{
+		AGameModeBase* const GameMode = GetWorld()->GetAuthGameMode();
+		if (GameMode && GameMode->GameSession)
+		{
+			UE_LOG(LogAtomPlayerController, Warning, TEXT("Kicking %s for %d rejected RPCs in %.1f seconds"), *GetNameSafe(PlayerState), RecentRejections, KickRejectionWindow);
+
+			bIsKickedForInvalidRpcs = true;
+			GameMode->GameSession->KickPlayer(this, NSLOCTEXT("AtomPlayerController", "KickedForInvalidRpcs", "Kicked for sending invalid requests to the server."));
+		}
+	}
+}
+
+void AAtomPlayerController::DumpRejectedRpcs() const
+{
+	FString Counts;
+	for (uint8 i = 0; i < static_cast<uint8>(EServerRpcFamily::MAX_COUNT); ++i)
+	{
+		Counts += FString::Printf(TEXT(" %s=%u"), ServerRpcFamilyNames[i], RejectedRpcCounts[i]);
+	}
+
+	UE_LOG(LogAtomPlayerController, Log, TEXT("%s rejected RPCs:%s"), *GetNameSafe(PlayerState), *Counts);
+}
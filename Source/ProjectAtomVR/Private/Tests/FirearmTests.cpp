@@ -0,0 +1,270 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#include "ProjectAtomVR.h"
+
+#include "AutomationTest.h"
+#include "AIController.h"
+#include "AtomCharacter.h"
+#include "AtomFirearm.h"
+#include "FirearmMagazine.h"
+#include "FirearmBenchmark.h"
+#include "MagazineAmmoLoader.h"
+#include "CartridgeAmmoLoader.h"
+#include "EquippableStateFiring.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	static const TCHAR* CharacterClassPath = TEXT("/Game/Characters/Blitz/BP_Blitz.BP_Blitz_C");
+	static const TCHAR* MagazineFirearmClassPath = TEXT("/Game/Equippables/AKM/BP_AKM.BP_AKM_C");
+	static const TCHAR* CartridgeFirearmClassPath = TEXT("/Game/Equippables/M1014/BP_M1014.BP_M1014_C");
+
+	static const FName MagazineAttachSocket{ TEXT("MagazineAttach") };
+
+	// Shots per trigger pull when testing burst fire
+	constexpr int32 TestBurstCount = 3;
+
+	// Frame time the test world is ticked at
+	constexpr float TestDeltaTime = 1.f / 90.f;
+
+	// Frames to wait on a firing sequence or magazine load before failing
+	constexpr int32 MaxWaitFrames = 2000;
+
+	/** Game world with its own world context, destroyed with the test. */
+	struct FFirearmTestWorld
+	{
+		FFirearmTestWorld()
+		{
+			World = UWorld::CreateWorld(EWorldType::Game, false);
+
+			FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+			WorldContext.SetCurrentWorld(World);
+
+			World->InitializeActorsForPlay(FURL{});
+			World->BeginPlay();
+		}
+
+		~FFirearmTestWorld()
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+
+		void Tick(int32 Frames = 1)
+		{
+			for (int32 i = 0; i < Frames; ++i)
+			{
+				World->Tick(LEVELTICK_All, TestDeltaTime);
+			}
+		}
+
+		UWorld* World;
+	};
+}
+
+/**
+ * Fires and reloads a firearm for each ammo loader type and fire mode. Checks shots fired against the rounds
+ * loaded, the chamber and ammo count after each sequence, and that reloading and chambering restores them.
+ * The fire and reload path is recorded by FFirearmBenchmark while the test runs.
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FFirearmFireAndReloadTest, "ProjectAtom.Firearms.FireAndReload",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+void FFirearmFireAndReloadTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const TCHAR* Loader : { TEXT("Magazine"), TEXT("Cartridge") })
+	{
+		for (const TCHAR* FireMode : { TEXT("FullAuto"), TEXT("Burst") })
+		{
+			const FString TestName = FString::Printf(TEXT("%s.%s"), Loader, FireMode);
+			OutBeautifiedNames.Add(TestName);
+			OutTestCommands.Add(TestName);
+		}
+	}
+}
+
+bool FFirearmFireAndReloadTest::RunTest(const FString& Parameters)
+{
+	FString LoaderName, FireModeName;
+	Parameters.Split(TEXT("."), &LoaderName, &FireModeName);
+
+	const bool bIsMagazineLoader = (LoaderName == TEXT("Magazine"));
+	const bool bIsBurst = (FireModeName == TEXT("Burst"));
+
+	UClass* const CharacterClass = LoadClass<AAtomCharacter>(nullptr, CharacterClassPath);
+	UClass* const FirearmClass = LoadClass<AAtomFirearm>(nullptr, bIsMagazineLoader ? MagazineFirearmClassPath : CartridgeFirearmClassPath);
+
+	if (CharacterClass == nullptr || FirearmClass == nullptr)
+	{
+		AddError(TEXT("Failed to load character or firearm class"));
+		return false;
+	}
+
+	FFirearmTestWorld TestWorld;
+	UWorld* const World = TestWorld.World;
+
+	// AI controllers are local in standalone, so the firearm fires with authority and without player input
+	AAtomCharacter* const Character = World->SpawnActor<AAtomCharacter>(CharacterClass, FTransform::Identity);
+	AAIController* const Controller = World->SpawnActor<AAIController>();
+
+	if (Character == nullptr || Controller == nullptr)
+	{
+		AddError(TEXT("Failed to spawn character"));
+		return false;
+	}
+
+	Controller->Possess(Character);
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = Character;
+	SpawnParams.Instigator = Character;
+
+	AAtomFirearm* const Firearm = World->SpawnActor<AAtomFirearm>(FirearmClass, Character->GetActorTransform(), SpawnParams);
+
+	if (Firearm == nullptr)
+	{
+		AddError(TEXT("Failed to spawn firearm"));
+		return false;
+	}
+
+	UAmmoLoader* const AmmoLoader = Firearm->GetAmmoLoader();
+	UEquippableStateFiring* const FiringState = Cast<UEquippableStateFiring>(Firearm->GetFiringState());
+
+	if (FiringState == nullptr)
+	{
+		AddError(FString::Printf(TEXT("%s has no firing state"), *FirearmClass->GetName()));
+		return false;
+	}
+
+	const UClass* const AmmoLoaderClass = bIsMagazineLoader ? UMagazineAmmoLoader::StaticClass() : UCartridgeAmmoLoader::StaticClass();
+	if (AmmoLoader == nullptr || !AmmoLoader->IsA(AmmoLoaderClass))
+	{
+		AddError(FString::Printf(TEXT("%s does not use a %s"), *FirearmClass->GetName(), *AmmoLoaderClass->GetName()));
+		return false;
+	}
+
+	Character->Equip(Firearm, EHand::Right);
+	TestTrue(TEXT("Firearm equipped"), Firearm->IsEquipped());
+
+	FiringState->SetBurstCount(bIsBurst ? TestBurstCount : 0);
+
+	const int32 LoadedAmmo = AmmoLoader->GetAmmoCount();
+	TestTrue(TEXT("Initial ammo loaded"), LoadedAmmo > 0);
+	TestFalse(TEXT("Initial round chambered"), Firearm->IsChamberEmpty());
+
+	// Pulls the trigger once and waits for the firing state to pop. Returns the shots fired.
+	auto PullTrigger = [&]() -> int32
+	{
+		// Wait out the fire rate, otherwise entering the state dry fires
+		const float FireRate = Firearm->GetFirearmStats().FireRate;
+		while (World->GetTimeSeconds() - FiringState->GetLastShotTimestamp() < FireRate)
+		{
+			TestWorld.Tick();
+		}
+
+		Firearm->PushState(FiringState);
+
+		for (int32 Frame = 0; Frame < MaxWaitFrames && Firearm->GetCurrentState() == FiringState; ++Frame)
+		{
+			TestWorld.Tick();
+		}
+
+		if (Firearm->GetCurrentState() == FiringState)
+		{
+			AddError(TEXT("Firing state was not popped"));
+			Firearm->PopState(FiringState);
+		}
+
+		return FiringState->GetShotsFired();
+	};
+
+	// Fires until the chamber is empty, checking the shots of each trigger pull. Returns the total shots fired.
+	auto FireUntilEmpty = [&](int32 Rounds) -> int32
+	{
+		int32 TotalShots = 0;
+
+		while (!Firearm->IsChamberEmpty() && TotalShots < Rounds)
+		{
+			const int32 ExpectedShots = bIsBurst ? FMath::Min(TestBurstCount, Rounds - TotalShots) : Rounds - TotalShots;
+			const int32 Shots = PullTrigger();
+
+			TestEqual(TEXT("Shots fired by trigger pull"), Shots, ExpectedShots);
+
+			if (Shots <= 0)
+				break;
+
+			TotalShots += Shots;
+		}
+
+		return TotalShots;
+	};
+
+	FFirearmBenchmark::Start();
+
+	// Every loaded round plus the chambered round
+	const int32 FirstShots = FireUntilEmpty(LoadedAmmo + 1);
+	TestEqual(TEXT("Shots fired from initial ammo"), FirstShots, LoadedAmmo + 1);
+	TestTrue(TEXT("Chamber empty after firing initial ammo"), Firearm->IsChamberEmpty());
+	TestEqual(TEXT("Ammo after firing initial ammo"), AmmoLoader->GetAmmoCount(), 0);
+	TestFalse(TEXT("Can fire with empty chamber"), Firearm->CanFire());
+
+	TestEqual(TEXT("Dry fire shots"), PullTrigger(), 0);
+
+	// Refill
+	if (bIsMagazineLoader)
+	{
+		Firearm->DiscardAmmo();
+		TestEqual(TEXT("Ammo after discarding magazine"), AmmoLoader->GetAmmoCount(), 0);
+
+		UMagazineAmmoLoader* const MagazineLoader = CastChecked<UMagazineAmmoLoader>(AmmoLoader);
+		AFirearmMagazine* const Magazine = World->SpawnActor<AFirearmMagazine>(MagazineLoader->GetMagazineTemplate(),
+			Firearm->GetMesh()->GetSocketTransform(MagazineAttachSocket), SpawnParams);
+
+		if (Magazine == nullptr)
+		{
+			AddError(TEXT("Failed to spawn magazine"));
+			FFirearmBenchmark::Stop(Parameters);
+			return false;
+		}
+
+		Firearm->LoadAmmo(Magazine);
+
+		// Magazines after the first are eased into the firearm before the ammo count is set
+		for (int32 Frame = 0; Frame < MaxWaitFrames && AmmoLoader->GetAmmoCount() == 0; ++Frame)
+		{
+			TestWorld.Tick();
+		}
+	}
+	else
+	{
+		for (int32 i = 0; i < LoadedAmmo; ++i)
+		{
+			Firearm->LoadAmmo(nullptr);
+		}
+	}
+
+	TestEqual(TEXT("Ammo after reload"), AmmoLoader->GetAmmoCount(), LoadedAmmo);
+	TestTrue(TEXT("Chamber empty after reload"), Firearm->IsChamberEmpty());
+	TestFalse(TEXT("Can fire before chambering"), Firearm->CanFire());
+
+	Firearm->ChamberRound();
+	TestFalse(TEXT("Round chambered"), Firearm->IsChamberEmpty());
+	TestEqual(TEXT("Ammo after chambering"), AmmoLoader->GetAmmoCount(), LoadedAmmo - 1);
+
+	const int32 ReloadShots = FireUntilEmpty(LoadedAmmo);
+	TestEqual(TEXT("Shots fired after reload"), ReloadShots, LoadedAmmo);
+	TestTrue(TEXT("Chamber empty after firing reloaded ammo"), Firearm->IsChamberEmpty());
+	TestEqual(TEXT("Ammo after firing reloaded ammo"), AmmoLoader->GetAmmoCount(), 0);
+
+	TestEqual(TEXT("Timed shots"), FFirearmBenchmark::GetSampleCount(EFirearmBenchmarkTimer::FireShot), FirstShots + ReloadShots);
+
+	FFirearmBenchmark::Stop(Parameters);
+
+	Character->Unequip(Firearm, EHand::Right);
+	TestFalse(TEXT("Firearm unequipped"), Firearm->IsEquipped());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -30,6 +30,10 @@
 
 DEFINE_LOG_CATEGORY(LogVRHUD);
 
+DECLARE_CYCLE_STAT(TEXT("VRHUD Tick"), STAT_VRHUDTick, STATGROUP_ProjectAtom);
+DECLARE_CYCLE_STAT(TEXT("VRHUD Update Help Indicators"), STAT_VRHUDUpdateHelpIndicators, STATGROUP_ProjectAtom);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("VRHUD Active Help Indicators"), STAT_VRHUDActiveHelpIndicators, STATGROUP_ProjectAtom);
+
 #define LOCTEXT_NAMESPACE "VRHUD"
 
 namespace
@@ -120,6 +124,8 @@ void AVRHUD::Destroyed()
 
 void AVRHUD::Tick(float DeltaSeconds)
 {
+	SCOPE_CYCLE_COUNTER(STAT_VRHUDTick);
+
 	Super::Tick(DeltaSeconds);
 
 	// Update player HUD proxies
@@ -134,6 +140,9 @@ void AVRHUD::Tick(float DeltaSeconds)
 		FVector HeadLocation; FRotator HeadRot;
 		PlayerController->GetActorEyesViewPoint(HeadLocation, HeadRot);
 
+		SCOPE_CYCLE_COUNTER(STAT_VRHUDUpdateHelpIndicators);
+		SET_DWORD_STAT(STAT_VRHUDActiveHelpIndicators, ActiveHelpIndicators.Num());
+
 		for (int32 i = 0; i < ActiveHelpIndicators.Num();)
 		{
 			if (ActiveHelpIndicators[i].Indicator.IsValid())
@@ -27,6 +27,7 @@ public class ProjectAtomVR : ModuleRules
 
 		PrivateDependencyModuleNames.AddRange(
 			new string[] {
+                "AIModule",
                 "OnlineSubsystem",
                 "OnlineSubsystemUtils",
                 "Slate",
@@ -23,6 +23,9 @@
 DECLARE_LOG_CATEGORY_EXTERN(LogAtom, Log, All); // A general log for your general needs
 DECLARE_LOG_CATEGORY_EXTERN(LogAtomOnlineSession, Log, All);
 
+/** Stats */
+DECLARE_STATS_GROUP(TEXT("ProjectAtom"), STATGROUP_ProjectAtom, STATCAT_Advanced);
+
 namespace AtomCollisionProfiles
 {
 	static const FName HeroHand{ TEXT("HeroHand") };
@@ -75,6 +75,123 @@ struct PROJECTATOMVR_API FMotionTransformRep
 	FRotator Rotation;
 };
 
+/**
+ * Head and hand transforms for a single character, relative to the character root. Sent unreliably
+ * so each pose carries a sequence number that is used to discard stale or out of order poses, and the
+ * server world time it was captured at so simulated proxies interpolate on the sender's timeline.
+ *
+ * Hand locations are delta encoded against the head location and all rotations are sent as shorts.
+ */
+USTRUCT()
+struct PROJECTATOMVR_API FMotionPoseRep
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY()
+	uint16 Sequence = 0;
+
+	/** Server world time, as seen by the owning client, when the pose was captured. */
+	UPROPERTY()
+	float TimeStamp = 0.f;
+
+	UPROPERTY()
+	FMotionTransformRep Head;
+
+	UPROPERTY()
+	FMotionTransformRep LeftHand;
+
+	UPROPERTY()
+	FMotionTransformRep RightHand;
+
+	UPROPERTY()
+	uint8 bIsLeftHandTracked : 1;
+
+	UPROPERTY()
+	uint8 bIsRightHandTracked : 1;
+
+	FMotionPoseRep()
+		: bIsLeftHandTracked(false)
+		, bIsRightHandTracked(false)
+	{
+	}
+
+	/** If this pose was sent after another pose sequence. Handles sequence wrap around. */
+	bool IsNewerThan(uint16 OtherSequence) const
+	{
+		return static_cast<int16>(Sequence - OtherSequence) > 0;
+	}
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FMotionPoseRep> : public TStructOpsTypeTraitsBase
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
+/** Server RPCs that share a rate limit per connection. */
+enum class EServerRpcFamily : uint8
+{
+	Fire, // Shot batches. Rate limited.
+	Ammo, // Loading and discarding ammo
+	Equip, // Equipping, dropping, and equippable state changes
+	Pose, // Head and hand poses. Rate limited.
+	MAX_COUNT
+};
+
+/** What the server does with a connection that keeps sending rejected RPCs. */
+UENUM()
+enum class EInvalidRpcAction : uint8
+{
+	Ignore, // Only drop the rejected RPCs
+	Kick // Drop the rejected RPCs and kick the player once over the rejection threshold
+};
+
+USTRUCT()
+struct PROJECTATOMVR_API FRpcRateLimit
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Sustained number of RPCs allowed each second. */
+	UPROPERTY(EditDefaultsOnly, Category = RateLimit)
+	float TokensPerSecond = 10.f;
+
+	/** Number of RPCs allowed back to back after being idle. */
+	UPROPERTY(EditDefaultsOnly, Category = RateLimit)
+	float BurstSize = 10.f;
+};
+
+/**
+ * Token bucket used to rate limit requests. Refills at a fixed rate up to a burst size and starts full.
+ */
+struct FTokenBucket
+{
+	float Tokens = 0.f;
+	float LastRefillTime = -1.f;
+
+	/** Takes Cost tokens if available. Returns false, taking nothing, if the bucket does not have enough. */
+	bool TryConsume(float CurrentTime, float TokensPerSecond, float BurstSize, float Cost = 1.f)
+	{
+		Tokens = (LastRefillTime < 0.f) ? BurstSize : FMath::Min(BurstSize, Tokens + (CurrentTime - LastRefillTime) * TokensPerSecond);
+		LastRefillTime = CurrentTime;
+
+		if (Tokens < Cost)
+			return false;
+
+		Tokens -= Cost;
+		return true;
+	}
+
+	bool TryConsume(float CurrentTime, const FRpcRateLimit& Limit, float Cost = 1.f)
+	{
+		return TryConsume(CurrentTime, Limit.TokensPerSecond, Limit.BurstSize, Cost);
+	}
+};
+
 UENUM()
 enum class ELoadoutType : uint8
 {
@@ -0,0 +1,110 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+ * Registry of the per world pool actors, i.e. AAtomEffectPool and AAtomEquippablePool. Pools register themselves
+ * once their components are initialized and unregister on EndPlay. One is spawned the first time it is requested.
+ */
+template <typename PoolType>
+class TAtomWorldPool
+{
+public:
+	/** Gets the pool for the world of a context object, spawning one if needed. Null if there is no world or spawning failed. */
+	static PoolType* Get(const UObject* WorldContextObject, FName PoolName)
+	{
+		UWorld* const World = GEngine->GetWorldFromContextObject(WorldContextObject, false);
+		if (World == nullptr)
+			return nullptr;
+
+		if (PoolType* const Pool = Find(World))
+			return Pool;
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Name = PoolName;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		return World->SpawnActor<PoolType>(SpawnParams);
+	}
+
+	/** Gets the pool for a world without spawning one. */
+	static PoolType* Find(const UWorld* World)
+	{
+		PoolType* const* Pool = WorldPools.Find(World);
+		return Pool ? *Pool : nullptr;
+	}
+
+	static void Register(PoolType* Pool) { WorldPools.Add(Pool->GetWorld(), Pool); }
+
+	static void Unregister(PoolType* Pool) { WorldPools.Remove(Pool->GetWorld()); }
+
+private:
+	static TMap<const UWorld*, PoolType*> WorldPools;
+};
+
+template <typename PoolType>
+TMap<const UWorld*, PoolType*> TAtomWorldPool<PoolType>::WorldPools;
+
+/**
+ * Objects released by a pool that are left as is until their linger time ends. Destroyed objects are dropped.
+ */
+template <typename ObjectType>
+class TAtomLingerList
+{
+public:
+	/** Adds an object that lingers until EndTime. Adding an object that is already lingering replaces its end time. */
+	void Add(ObjectType* Object, float EndTime)
+	{
+		const int32 Index = Objects.Find(Object);
+		if (Index != INDEX_NONE)
+		{
+			EndTimes[Index] = EndTime;
+		}
+		else
+		{
+			Objects.Add(Object);
+			EndTimes.Add(EndTime);
+		}
+	}
+
+	/** Stops an object from lingering without calling the expired function, i.e. it was reused. */
+	void Remove(ObjectType* Object)
+	{
+		const int32 Index = Objects.Find(Object);
+		if (Index != INDEX_NONE)
+		{
+			Objects.RemoveAtSwap(Index, 1, false);
+			EndTimes.RemoveAtSwap(Index, 1, false);
+		}
+	}
+
+	/** Removes all objects done lingering at CurrentTime and calls OnExpired for each one that is still valid. */
+	template <typename ExpiredFunc>
+	void RemoveExpired(float CurrentTime, ExpiredFunc OnExpired)
+	{
+		for (int32 i = 0; i < Objects.Num();)
+		{
+			if (EndTimes[i] <= CurrentTime || !Objects[i].IsValid())
+			{
+				ObjectType* const Object = Objects[i].Get();
+
+				Objects.RemoveAtSwap(i, 1, false);
+				EndTimes.RemoveAtSwap(i, 1, false);
+
+				if (Object)
+				{
+					OnExpired(Object);
+				}
+			}
+			else
+			{
+				++i;
+			}
+		}
+	}
+
+	int32 Num() const { return Objects.Num(); }
+
+private:
+	TArray<TWeakObjectPtr<ObjectType>> Objects;
+	TArray<float> EndTimes; // Parallel to Objects
+};
@@ -34,6 +34,8 @@ public:
 
 	bool IsRightHanded() const { return bIsRightHanded; }
 
+	bool IsDying() const { return bIsDying; }
+
 	virtual void Equip(AAtomEquippable* Item, const EHand Hand);
 
 	/** Called by Equippable when the equipping process is complete. */
@@ -95,6 +97,12 @@ public:
 
 	virtual void NotifyTeamChanged();
 
+	/** 
+	 * Resets the character in place for a new round. Restores health and the loadout, drops held items and moves
+	 * the character to a new location. Server only.
+	 */
+	virtual void ResetForRound(const FVector& Location, const FRotator& Rotation);
+
 	/** ACharacter Interface Begin */
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual FVector GetPawnViewLocation() const override;
@@ -162,6 +170,12 @@ private:
 	UPROPERTY(VisibleAnywhere, Instanced, BlueprintReadOnly, Category = AtomCharacter, meta = (AllowPrivateAccess = "true"))
 	class UAtomLoadout* Loadout;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = AtomCharacter, meta = (AllowPrivateAccess = "true"))
+	class UAtomLagCompensationComponent* LagCompensation;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = AtomCharacter, meta = (AllowPrivateAccess = "true"))
+	class UNetMotionPoseComponent* MotionPose;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = AtomCharacter, meta = (AllowPrivateAccess = "true"))
 	AAtomEquippable* LeftHandEquippable;
 
@@ -206,6 +220,8 @@ public:
 	class UAtomCharacterMovementComponent* GetHeroMovementComponent() const;
 
 	class UHMDCameraComponent* GetCamera() const;
+
+	class UAtomLagCompensationComponent* GetLagCompensation() const;
 	
 	/** Gets the body mesh for the hero. This is also the mesh that loadout items are attached to. */
 	UStaticMeshComponent* GetBodyMesh() const;
@@ -266,6 +282,11 @@ FORCEINLINE UHMDCameraComponent* AAtomCharacter::GetCamera() const
 	return Camera;
 }
 
+FORCEINLINE UAtomLagCompensationComponent* AAtomCharacter::GetLagCompensation() const
+{
+	return LagCompensation;
+}
+
 FORCEINLINE UStaticMeshComponent* AAtomCharacter::GetBodyMesh() const
 {
 	return BodyMesh;
@@ -0,0 +1,93 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "AtomLagCompensationComponent.generated.h"
+
+/**
+ * Server only component that keeps a short history of the hit relevant physics bodies on its owner.
+ * Shots fired by remote clients can rewind the bodies to the time the shooter saw them, trace, and
+ * restore them before any damage is processed.
+ */
+UCLASS(Config=Game)
+class PROJECTATOMVR_API UAtomLagCompensationComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UAtomLagCompensationComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	/**
+	* Moves all tracked physics bodies to their recorded transforms at a specified world time. Only the
+	* physics representation is moved, so no overlaps or component transform updates are generated.
+	*
+	* @returns True if the bodies were rewound and need to be restored.
+	*/
+	bool RewindTo(float WorldTime);
+
+	/** Restores all physics bodies moved by RewindTo. */
+	void Restore();
+
+	/** Clears all recorded history. */
+	void ClearHistory();
+
+	/** Gets the max amount of time, in seconds, that a shot may be rewound. */
+	float GetMaxRewindTime() const { return MaxRewindTime; }
+
+	/** Gets the seconds that remote clients delay the owner's tracked devices before displaying them. */
+	float GetInterpolationDelay() const { return InterpolationDelay; }
+
+	/** UActorComponent Interface Begin */
+	virtual void BeginPlay() override;
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	/** UActorComponent Interface End */
+
+private:
+	/** Gathers all bodies on the owner that can be hit by instant shots. */
+	void GatherTrackedBodies(TArray<FBodyInstance*>& OutBodies) const;
+
+	void RecordFrame();
+
+protected:
+	/**
+	* Max shooter round trip time, in ms, that is compensated. The max rewind time and history size are derived
+	* from this, the owner's interpolation delay and the shot batch interval.
+	*/
+	UPROPERTY(EditDefaultsOnly, Config, Category = LagCompensation)
+	float MaxCompensatedPing = 250.f;
+
+private:
+	float MaxRewindTime = 0.f; // Max time in seconds that a shot can be rewound. Shooters with higher latency are clamped to this.
+	float InterpolationDelay = 0.f; // Max interpolation delay of the owner's camera and hands on remote clients
+
+	struct FHistoryFrame
+	{
+		float Timestamp = 0.f;
+		TArray<FTransform> BodyTransforms;
+	};
+
+	TArray<FHistoryFrame> History; // Ring buffer of recorded frames
+	int32 HistoryHead = 0; // Index of the next frame to record
+	int32 HistoryNum = 0; // Number of valid frames in History
+
+	TArray<FBodyInstance*> TrackedBodies; // Reused each record/rewind
+	TArray<FTransform> RestoreTransforms; // Body transforms before rewinding
+	uint32 bIsRewound : 1;
+};
+
+/**
+ * Rewinds all characters, other than the shooter, to the time the shooter saw them for the lifetime
+ * of the scope. This is the shooter latency plus the interpolation delay of each character on the
+ * shooter's client. Does nothing for locally controlled shooters.
+ *
+ * @param AdditionalRewindTime Seconds to rewind on top of the shooter latency, i.e. time a shot was held by the client.
+ */
+struct PROJECTATOMVR_API FScopedLagCompensation
+{
+	FScopedLagCompensation(class AAtomCharacter* Shooter, float AdditionalRewindTime = 0.f);
+	~FScopedLagCompensation();
+
+private:
+	TArray<UAtomLagCompensationComponent*, TInlineAllocator<16>> RewoundComponents;
+};
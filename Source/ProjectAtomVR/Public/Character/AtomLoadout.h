@@ -37,8 +37,64 @@ struct FAtomLoadoutSlot
 	UPROPERTY(BlueprintReadOnly)
 	int32 Count = 0;
 
-	// The trigger volume for the item's storage location
-	class USphereComponent* StorageTrigger = nullptr;
+	// Center of the item's storage volume relative to the body mesh. Only valid on locally controlled characters.
+	FVector StorageLocation = FVector::ZeroVector;
+
+	// Radius of the item's storage volume
+	float StorageRadius = 0.f;
+};
+
+/**
+ * Replicated item and count of a single loadout slot.
+ */
+USTRUCT()
+struct FAtomLoadoutSlotRep : public FFastArraySerializerItem
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY()
+	AAtomEquippable* Item = nullptr;
+
+	UPROPERTY()
+	int32 Count = 0;
+
+	// Index of the slot in the loadout
+	UPROPERTY()
+	uint8 SlotIndex = 0;
+
+	void PostReplicatedAdd(const struct FAtomLoadoutSlotArray& InArraySerializer);
+	void PostReplicatedChange(const struct FAtomLoadoutSlotArray& InArraySerializer);
+	void PreReplicatedRemove(const struct FAtomLoadoutSlotArray& InArraySerializer);
+};
+
+/**
+ * Loadout slots replicated with fast array delta serialization. Only slots marked dirty are sent, and each
+ * received slot is applied to its owning loadout individually.
+ */
+USTRUCT()
+struct FAtomLoadoutSlotArray : public FFastArraySerializer
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY()
+	TArray<FAtomLoadoutSlotRep> Items;
+
+	// Loadout that received slots are applied to
+	class UAtomLoadout* Loadout = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FAtomLoadoutSlotRep, FAtomLoadoutSlotArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FAtomLoadoutSlotArray> : public TStructOpsTypeTraitsBase
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
 };
 
 /**
@@ -71,19 +127,32 @@ public:
 	void DisableLoadout();
 
 	/**
-	* Destroys all loadout items. Should be called when the owning character is destroyed.
+	* Plays haptic feedback when a hand enters a slot's storage volume. Should be called each frame on
+	* locally controlled characters.
+	*/
+	void UpdateHandStorageOverlaps();
+
+	/**
+	* Returns all loadout items to the equippable pool so the next spawned loadout can reuse them. Items that
+	* cannot be pooled are destroyed. Should be called when the owning character dies or is destroyed.
+	*/
+	void ReleaseLoadout();
+
+	/**
+	* Replaces all loadout items with new items from the loadout template and restores slot counts. Used to reuse 
+	* the owning character between rounds. Should only be called on the server.
 	*/
-	void DestroyLoadout();
+	void ResetLoadout();
 
 	/**
-	* Requests an equip from the loadout. OverlapComponent will be used to check for overlaps with loadout slots to see if 
+	* Requests an equip from the loadout. The bounds of OverlapComponent will be used to check for overlaps with loadout slots to see if 
 	* the component is within the bounds of a loadout item. If successful, the AHeroBase::Equip will be called on the owning 
 	* hero with the corresponding loadout item.
 	**/
 	bool RequestEquip(UPrimitiveComponent* OverlapComponent, const EHand Hand);
 
 	/**
-	 * Requests an unequip from the loadout. OverlapComponent will be used to check for overlaps with loadout slots to see 
+	 * Requests an unequip from the loadout. The bounds of OverlapComponent will be used to check for overlaps with loadout slots to see 
 	 * if the component is in the correct location to unequip the specified item. If successful, the AHeroBase::Unequip 
 	 * will be called on the owning hero.
 	 **/
@@ -134,9 +203,8 @@ public:
 
 	USceneComponent* GetAttachParent() const;
 
-	/** UObject Interface Begin */
-	virtual void PreNetReceive() override;
-	/** UObject Interface End */	
+	/** Applies a slot received through replication and notifies OnSlotChanged of any differences. */
+	void OnSlotReplicated(int32 SlotIndex, AAtomEquippable* Item, int32 Count);
 
 protected:
 	int32 GetItemIndex(const AAtomEquippable* Item) const;
@@ -149,17 +217,33 @@ protected:
 	/**
 	* Updates all the slot offsets. Should only be called on locally controlled characters.
 	*/
-	void UpdateSlotOffset(const FAtomLoadoutSlot& Slot, const FAtomLoadoutTemplateSlot& TemplateSlot);
+	void UpdateSlotOffset(FAtomLoadoutSlot& Slot, const FAtomLoadoutTemplateSlot& TemplateSlot);
+
+	/** 
+	* Finds the slot with the nearest storage volume overlapping the bounds of a component.
+	* @returns The slot index or INDEX_NONE if no storage volume is overlapped or storage is inactive.
+	*/
+	int32 FindStorageSlot(const UPrimitiveComponent* OverlapComponent) const;
 
-	UFUNCTION()
-	void OnRep_Loadout();
+	/**
+	* Checks if the bounds of a component overlap the storage volume of a slot.
+	* @param OutDistSquared Squared distance between the bounds and storage volume centers.
+	*/
+	bool IsOverlappingStorage(int32 SlotIndex, const UPrimitiveComponent* OverlapComponent, float& OutDistSquared) const;
+
+	/** Enables or disables storage interaction. Storage is only active on locally controlled characters. */
+	void SetStorageActive(bool bIsActive);
+
+	/** Copies a slot to ReplicatedSlots and marks it for replication. Server only. */
+	void MarkSlotDirty(int32 SlotIndex);
 
 private:
 	/** Creates all loadout weapons. Should only be called on server. */
 	void CreateLoadoutEquippables(const TArray<FAtomLoadoutTemplateSlot>& LoadoutTemplateSlots);
 
-	/** Creates all loadout item triggers. Should only be called on controlling players. */
-	void CreateLoadoutTriggers(const TArray<FAtomLoadoutTemplateSlot>& LoadoutTemplateSlots);
+	/** Returns all slot items to the equippable pool or destroys them if they cannot be pooled. */
+	void ReleaseLoadoutItems();
+
 	
 	/** UObject Interface Begin */
 	virtual void GetLifetimeReplicatedProps(TArray<class FLifetimeProperty> & OutLifetimeProps) const override;
@@ -167,14 +251,6 @@ private:
 	virtual class UWorld* GetWorld() const override;
 	/** UObject Interface End */
 
-private:
-	/** 
-	 * Called when the player's hand overlaps one of the loadout triggers. 
-	 */
-	UFUNCTION()
-	void OnLoadoutTriggerOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, 
-		int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
-
 protected:
 	UPROPERTY(EditDefaultsOnly, Category = HeroLoadout)
 	TSubclassOf<class UAtomLoadoutTemplate> LoadoutTemplate;
@@ -186,8 +262,17 @@ protected:
 	float LoadoutSlotOffset = 0.f; // Local offset for each item in XY direction from body. Only on local controlled characters.
 
 private:
-	UPROPERTY(ReplicatedUsing=OnRep_Loadout, VisibleAnywhere, Category = HeroLoadout)
+	UPROPERTY(VisibleAnywhere, Category = HeroLoadout)
 	TArray<FAtomLoadoutSlot> Loadout;
 
+	UPROPERTY(Replicated)
+	FAtomLoadoutSlotArray ReplicatedSlots;
+
 	class AAtomCharacter* CharacterOwner = nullptr;
+
+	/** Slot storage volume each hand was in last update. Used to play feedback once on entering. */
+	int32 HandStorageSlots[2] = { INDEX_NONE, INDEX_NONE };
+
+	/** True if hands can interact with storage volumes. */
+	bool bIsStorageActive = false;
 };
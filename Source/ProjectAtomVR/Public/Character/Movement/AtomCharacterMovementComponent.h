@@ -23,6 +23,16 @@ public:
 protected:
 	class UHMDCapsuleComponent* GetHMDCapsule() const;
 
+	/**
+	* Server only. Checks a teleport requested by the client against the navmesh, the reach of the character's
+	* teleport arc, and TeleportCooldown. Rejected teleports are not performed, so the client is corrected back
+	* to the server location.
+	*/
+	bool IsValidTeleport(const FVector& Destination) const;
+
+	/** Gets the max horizontal distance of a teleport, from the teleport arc range plus TeleportReach. Zero without a teleport movement type. */
+	float GetMaxTeleportDistance() const;
+
 	/** UCharacterMovementComponent Interface Begin */
 public:
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
@@ -45,6 +55,22 @@ protected:
 	/** UActorComponent Interface End */
 
 protected:
+	/** Max horizontal distance, in cm, of the hand launching the teleport arc from the head. Added to the arc range when validating teleports. */
+	UPROPERTY(EditDefaultsOnly, Category = "Character Movement: Teleport")
+	float TeleportReach = 100.f;
+
+	/**
+	* Min seconds between teleports, measured in server time when the teleport move is received. Should be below the
+	* client's own min time between teleports so network jitter does not reject valid teleports.
+	*/
+	UPROPERTY(EditDefaultsOnly, Category = "Character Movement: Teleport")
+	float TeleportCooldown = 0.25f;
+
+	/** Max horizontal distance a teleport destination may be from the navmesh. Destinations are offset from the
+	 ** navmesh by the head's offset in the play area. */
+	UPROPERTY(EditDefaultsOnly, Category = "Character Movement: Teleport")
+	float TeleportNavTolerance = 200.f;
+
 	friend class FSavedMove_AtomCharacter;
 	uint32 bWantsToTeleport : 1;
 
@@ -54,6 +80,9 @@ protected:
 private:
 	UFUNCTION()
 	void OnRep_PendingTeleportDestination();
+
+	/** Server only. Server world time of the last accepted teleport. */
+	float LastTeleportTime = -1.f;
 };
 
 
@@ -20,6 +20,9 @@ public:
 	virtual void SetupPlayerInputComponent(class UInputComponent* InputComponent) override;
 	/** UHeroMovementType Interface End */
 
+	/** Gets the max horizontal distance the teleport arc can reach. Horizontal speed along the arc never exceeds the launch velocity. */
+	float GetMaxArcDistance() const { return TeleportArcVelocity * ArcMaxSimTime; }
+
 	/** UActorComponent Interface Begin */
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	virtual void DestroyComponent(bool bPromoteChildren = false) override;
@@ -37,18 +40,28 @@ protected:
 	* Traces out the current teleportation arc.
 	* 
 	* @param OutHit		The hit destination of the teleportation.
-	* @param OutArcPath	The arc path for the teleportation.
+	* @param PathResult	The arc path for the teleportation. Reused between traces to keep its allocation.
 	* @returns True if the path hit something.
 	*/
 	virtual bool TraceArcPath(FHitResult& OutHit, FPredictProjectilePathResult& PathResult);
 
 	/**
-	* Updates the arc spline that represents the teleportation path.
+	* Updates the arc spline that represents the teleportation path. At most MaxArcSegments spline meshes are
+	* used, longer paths are resampled.
 	* 
-	* @param ArcPath The teleportation arc path.
+	* @param ArcPath The teleportation arc path in world space.
 	*/
 	virtual void UpdateArcSpline(const TArray<FVector>& ArcPath);
 
+	/** Traces the arc and updates the teleport actor and arc spline. */
+	void UpdateArc();
+
+	/** Creates the fixed pool of spline meshes used by the arc, if not already created. */
+	void CreateArcSegments();
+
+	/** Hides all arc spline meshes. */
+	void HideArcSegments();
+
 	/**
 	* Updates the teleport actor using a destination hit result. Responsible for
 	* validating the hit location and setting the bIsTargetValid flag on success.
@@ -74,7 +87,24 @@ protected:
 	UPROPERTY(EditAnywhere, Category = HeroTeleport)
 	UStaticMesh* ArcMesh = nullptr;
 
-	/** Spline meshes used to render the teleport arc each frame. */
+	/** Number of spline meshes kept to render the teleport arc. */
+	UPROPERTY(EditDefaultsOnly, Category = HeroTeleport, meta = (ClampMin = 1))
+	int32 MaxArcSegments = 24;
+
+	/** Times a second the teleport arc is traced while aiming. The arc follows the hand in between. */
+	UPROPERTY(EditDefaultsOnly, Category = HeroTeleport, meta = (ClampMin = 1))
+	float ArcUpdateRate = 30.f;
+
+	/** Steps a second used when simulating the teleport arc. */
+	UPROPERTY(EditDefaultsOnly, Category = HeroTeleport, meta = (ClampMin = 1))
+	float ArcSimFrequency = 7.f;
+
+	/** Max seconds the teleport arc is simulated for. */
+	UPROPERTY(EditDefaultsOnly, Category = HeroTeleport)
+	float ArcMaxSimTime = 2.5f;
+
+	/** Spline meshes used to render the teleport arc. Created once and hidden when unused. */
+	UPROPERTY(Transient)
 	TArray<class USplineMeshComponent*> SplineMeshes;
 
 private:	
@@ -85,6 +115,13 @@ private:
 	// Actor used represent the end position of a teleport
 	AActor* TeleportActor = nullptr;
 
+	// Reused each arc update
+	FPredictProjectilePathResult ArcPathResult;
+	TArray<FVector> ArcPoints;
+
+	/** Seconds since the arc was last traced. */
+	float TimeSinceArcUpdate = 0.f;
+
 	/** If the teleport destination is valid */
 	uint32 bIsTargetValid : 1;
 
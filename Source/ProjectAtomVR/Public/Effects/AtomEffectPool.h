@@ -0,0 +1,104 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "GameFramework/Actor.h"
+#include "AtomWorldPool.h"
+#include "AtomEffectPool.generated.h"
+
+/**
+ * Per world pool of particle, audio, and decal components used for short lived gameplay effects.
+ * Components are recycled once finished. When a pool is at its cap, the oldest component in use
+ * is stolen.
+ *
+ * Use AAtomEffectPool::Get to get the pool for a world. One is spawned on first use.
+ */
+UCLASS(NotPlaceable, Transient, Config = Game)
+class PROJECTATOMVR_API AAtomEffectPool : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AAtomEffectPool(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	/** Gets the effect pool for the world of a context object. Null if there is no world or one can't be spawned, i.e. during teardown. */
+	static AAtomEffectPool* Get(const UObject* WorldContextObject);
+
+	UParticleSystemComponent* SpawnEmitterAtLocation(UParticleSystem* Template, const FVector& Location, const FRotator& Rotation);
+
+	UParticleSystemComponent* SpawnEmitterAttached(UParticleSystem* Template, USceneComponent* AttachToComponent, FName AttachPointName = NAME_None);
+
+	UAudioComponent* SpawnSoundAtLocation(USoundBase* Sound, const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator);
+
+	UAudioComponent* SpawnSoundAttached(USoundBase* Sound, USceneComponent* AttachToComponent, FName AttachPointName = NAME_None);
+
+	/**
+	* Spawns a decal attached to a component. If the component is null, the decal is placed in the world.
+	*
+	* @param LifeSpan Seconds until the decal is returned to the pool. Decals with a LifeSpan <= 0 are only
+	*				  returned to the pool when stolen.
+	*/
+	UDecalComponent* SpawnDecalAttached(UMaterialInterface* DecalMaterial, const FVector& DecalSize, USceneComponent* AttachToComponent,
+		FName AttachPointName, const FVector& Location, const FRotator& Rotation, float LifeSpan);
+
+	/** Logs pool sizes and hit, miss, and steal counts. */
+	void DumpStats() const;
+
+	/** AActor Interface Begin */
+	virtual void PostInitializeComponents() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void Tick(float DeltaSeconds) override;
+	/** AActor Interface End */
+
+private:
+	struct FPoolStats
+	{
+		uint32 Hits = 0; // Reused a finished component
+		uint32 Misses = 0; // Created a new component
+		uint32 Steals = 0; // Reused the oldest active component
+	};
+
+	/**
+	* Gets the index of a component to use from a pool. Creates a new component if none are free and
+	* the pool is under its cap, otherwise steals the oldest.
+	*/
+	template <typename ComponentType, typename IsFreeFunc>
+	int32 AcquireComponent(TArray<ComponentType*>& Components, TArray<float>& UseTimes, int32 MaxComponents, FPoolStats& Stats, IsFreeFunc IsFree);
+
+	/** Detaches a component being reused if it was attached to something other than the pool. */
+	void ResetAttachment(USceneComponent* Component);
+
+protected:
+	/** Max particle components in the pool. */
+	UPROPERTY(EditDefaultsOnly, Config, Category = EffectPool)
+	int32 MaxParticleComponents = 64;
+
+	/** Max audio components in the pool. */
+	UPROPERTY(EditDefaultsOnly, Config, Category = EffectPool)
+	int32 MaxAudioComponents = 32;
+
+	/** Max decal components in the pool. */
+	UPROPERTY(EditDefaultsOnly, Config, Category = EffectPool)
+	int32 MaxDecalComponents = 128;
+
+private:
+	UPROPERTY(Transient)
+	TArray<UParticleSystemComponent*> ParticleComponents;
+
+	UPROPERTY(Transient)
+	TArray<UAudioComponent*> AudioComponents;
+
+	UPROPERTY(Transient)
+	TArray<UDecalComponent*> DecalComponents;
+
+	// Last time each component was acquired. Parallel to the component arrays.
+	TArray<float> ParticleUseTimes;
+	TArray<float> AudioUseTimes;
+	TArray<float> DecalUseTimes;
+
+	TAtomLingerList<UDecalComponent> LingeringDecals; // Visible decals with a life span, returned to the pool once it ends
+
+	FPoolStats ParticleStats;
+	FPoolStats AudioStats;
+	FPoolStats DecalStats;
+};
@@ -50,6 +50,16 @@ public:
 	*/
 	virtual void OnUnequipped();
 
+	/**
+	* Called when the owning firearm is stored in an AAtomEquippablePool.
+	*/
+	virtual void OnPooled();
+
+	/**
+	* Called when the owning firearm is reused from an AAtomEquippablePool. Should restore a full load of ammo.
+	*/
+	virtual void OnUnpooled();
+
 	UFUNCTION(BlueprintCallable, Category = AmmoLoader)
 	int32 GetAmmoCount() const;
 
@@ -22,6 +22,7 @@ public:
 	virtual void OnUnequipped() override;
 	virtual void ConsumeAmmo() override;
 	virtual void InitializeLoader() override;
+	virtual void OnUnpooled() override;
 	/** UAmmoLoader Interface End */
 
 protected:
@@ -25,8 +25,12 @@ public:
 	virtual void LoadAmmo(UObject* LoadObject) override;
 	virtual void InitializeLoader() override;
 	virtual void Destroy() override;
+	virtual void OnPooled() override;
+	virtual void OnUnpooled() override;
 	/** UAmmoLoader Interface End */
 
+	TSubclassOf<class AFirearmMagazine> GetMagazineTemplate() const;
+
 	/** UObject Interface Begin */
 	virtual void GetLifetimeReplicatedProps(TArray<class FLifetimeProperty> & OutLifetimeProps) const override;	
 	/** UObject Interface End */
@@ -50,6 +54,9 @@ protected:
 
 	void OnMagazineEjectPressed();
 
+	/** Spawns a magazine from MagazineTemplate and loads it. Authority only. */
+	void LoadDefaultMagazine();
+
 protected:
 	/** The type of magazine this firearm uses. Magazines will be attached to the "MagazineAttach" socket on the owning HeroFirearm mesh.*/
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = MagazineAmmoLoader)
@@ -77,3 +84,5 @@ private:
 	uint32 bIsLoadingMagazine : 1;
 	uint32 bHasInitialMagazine : 1;
 };
+
+FORCEINLINE TSubclassOf<class AFirearmMagazine> UMagazineAmmoLoader::GetMagazineTemplate() const { return MagazineTemplate; }
\ No newline at end of file
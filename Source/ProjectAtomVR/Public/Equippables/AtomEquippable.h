@@ -52,6 +52,41 @@ private:
 	uint32 ForceRepCounter : 1;
 };
 
+/**
+ * State stack of an Equippable sent by the owning client. States are referenced by their index in the
+ * Equippable's state list rather than by object.
+ */
+USTRUCT()
+struct FEquippableStateStackRep
+{
+	GENERATED_USTRUCT_BODY()
+
+	enum { MaxStackDepth = 15 };
+
+	/** Incremented each time the owning client changes the stack. Reset on equip. */
+	UPROPERTY()
+	uint8 Version = 0;
+
+	/** Equip count of the owning client when the stack was sent. Stacks from before the server's last equip are stale. */
+	UPROPERTY()
+	uint8 EquipCount = 0;
+
+	/** State indices from the bottom of the stack to the top. */
+	UPROPERTY()
+	TArray<uint8> StateIndices;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FEquippableStateStackRep> : public TStructOpsTypeTraitsBase
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
 /**
  * Base class for all equippable items. 
  * Provides functionality for equipping, unequipping and dropping items, as well as management for states and transitions.
@@ -148,6 +183,21 @@ public:
 	/** Gets the type of loadout item this is. */
 	ELoadoutType GetLoadoutType() const;
 
+	/** Hides and disables this while stored in an AAtomEquippablePool. Authority only, remotes follow through replication. */
+	void ReturnToPool();
+
+	/** Restores this to its spawned state when reused from an AAtomEquippablePool. Authority only. */
+	void ReuseFromPool(class AAtomCharacter* NewOwner);
+
+	/** Checks if this is stored in an AAtomEquippablePool. */
+	bool IsPooled() const;
+
+	/**
+	* Checks if this can be returned to an AAtomEquippablePool instead of being destroyed. Items with state that
+	* OnUnpooled cannot restore should return false.
+	*/
+	virtual bool CanBePooled() const;
+
 protected:
 	/** Sets up input for this item from the owning character. */
 	virtual void SetupInputComponent(UInputComponent* InputComponent);
@@ -162,6 +212,12 @@ protected:
 	/** Gets the original transform information for OffsetTarget. */
 	void GetOriginalOffsetTargetLocationAndRotation(FVector& LocationOut, FRotator& RotationOut) const;
 
+	/** Called when this is stored in the pool. Should disable anything that can interact with the world. */
+	virtual void OnPooled();
+
+	/** Called when this is reused from the pool. Should restore anything changed since spawning, i.e. by dropping. */
+	virtual void OnUnpooled();
+
 	UFUNCTION()
 	virtual void OnBeginOverlapSecondaryHandTrigger(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult & SweepResult);
 
@@ -179,14 +235,23 @@ private:
 	void ServerDrop();
 
 	UFUNCTION(Server, WithValidation, Reliable)
-	void ServerPushState(UEquippableState* State);
+	void ServerSetStateStack(const FEquippableStateStackRep& StackRep);
 
-	UFUNCTION(Server, WithValidation, Reliable)
-	void ServerPopState(UEquippableState* InPopState);
+	/** Sends the current state stack to the server. */
+	void SendStateStack();
+
+	/** Gets the network index of a state. */
+	uint8 GetStateIndex(const UEquippableState* State) const;
 
 	UFUNCTION()
 	void OnRep_EquipStatus();
 
+	UFUNCTION()
+	void OnRep_EquipCount();
+
+	UFUNCTION()
+	void OnRep_PoolCounter();
+
 	/** AActor Interface Begin */
 public:
 	virtual void BeginPlay() override;
@@ -196,6 +261,7 @@ public:
 	virtual bool ReplicateSubobjects(class UActorChannel *Channel, class FOutBunch *Bunch, FReplicationFlags *RepFlags) override;
 	virtual void GetSubobjectsWithStableNamesForNetworking(TArray<UObject*>& ObjList) override;
 	virtual void PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker) override;
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
 	virtual void Destroyed() override;
 
 protected:
@@ -246,10 +312,28 @@ protected:
 	/** Time stamp of when this item was last unequipped. */
 	float UnequipTimeStamp = 0.f;
 
+	/** Incremented each time this is pooled or reused. Odd while pooled. Remotes reset on any change, so a
+	 ** reuse is still seen if the pooled value never replicated. */
+	UPROPERTY(ReplicatedUsing = OnRep_PoolCounter)
+	uint8 PoolCounter = 0;
+
 private:
-	/** All Equippable states that support networking and are replicated. */
+	/** All Equippable states, in the same order on every connection. A state's index is used to reference it over the network. */
 	TArray<UEquippableState*> EquippableStates;
 
+	/** States with replicated properties. Only these are replicated as subobjects. */
+	TArray<UEquippableState*> ReplicatedStates;
+
+	/** Version of the last state stack sent by, or received from, the owning client. */
+	uint8 StateStackVersion = 0;
+
+	/** Number of times this has been equipped. Kept across equips so stacks sent before an equip can be told apart. */
+	uint8 EquipCount = 0;
+
+	/** The server's EquipCount, for the owning client to catch up on equips forced by the server. */
+	UPROPERTY(ReplicatedUsing = OnRep_EquipCount)
+	uint8 ReplicatedEquipCount = 0;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Equippable, meta = (AllowPrivateAccess = "true"))
 	class UMeshComponent* Mesh;
 
@@ -290,4 +374,5 @@ FORCEINLINE UEquippableState* AAtomEquippable::GetInactiveState() const { return
 FORCEINLINE UEquippableState* AAtomEquippable::GetActiveState() const { return ActiveState; }
 FORCEINLINE EHand AAtomEquippable::GetEquippedHand() const { return EquipStatus.Hand; }
 FORCEINLINE bool AAtomEquippable::IsEquipped() const { return EquipStatus.State == EEquipState::Equipped; }
-FORCEINLINE bool AAtomEquippable::IsSecondaryHandAttached() const { return bIsSecondaryHandAttached; }
\ No newline at end of file
+FORCEINLINE bool AAtomEquippable::IsSecondaryHandAttached() const { return bIsSecondaryHandAttached; }
+FORCEINLINE bool AAtomEquippable::IsPooled() const { return (PoolCounter & 1) != 0; }
\ No newline at end of file
@@ -0,0 +1,73 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "GameFramework/Actor.h"
+#include "AtomWorldPool.h"
+#include "AtomEquippablePool.generated.h"
+
+class AAtomEquippable;
+
+/**
+ * Per world, authority only pool of equippables such as magazines, cartridges, and reclaimed loadout items. Released
+ * equippables linger for a given time, then are hidden and kept per class to be reused by the next spawn
+ * of the same class. Pooled equippables are kept net relevant, so their actor channels stay open and reusing one
+ * does not respawn it on clients.
+ *
+ * Use AAtomEquippablePool::Get to get the pool for a world. One is spawned on first use.
+ */
+UCLASS(NotPlaceable, Transient, Config = Game)
+class PROJECTATOMVR_API AAtomEquippablePool : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AAtomEquippablePool(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	/** Gets the equippable pool for the world of a context object. Null if there is no world or one can't be spawned, i.e. during teardown. */
+	static AAtomEquippablePool* Get(const UObject* WorldContextObject);
+
+	/** Spawns an equippable owned by a character, reusing a pooled equippable of the same class if available. */
+	AAtomEquippable* SpawnEquippable(TSubclassOf<AAtomEquippable> EquippableClass, const FTransform& Transform, class AAtomCharacter* Owner);
+
+	template <typename EquippableType>
+	EquippableType* SpawnEquippable(TSubclassOf<EquippableType> EquippableClass, const FTransform& Transform, class AAtomCharacter* Owner)
+	{
+		return CastChecked<EquippableType>(SpawnEquippable(TSubclassOf<AAtomEquippable>{ *EquippableClass }, Transform, Owner), ECastCheckedType::NullAllowed);
+	}
+
+	/**
+	* Returns an equippable to the pool. The equippable is left as is until LingerTime has passed. If the pool for
+	* its class is full at that time, it is destroyed.
+	*/
+	void ReleaseEquippable(AAtomEquippable* Equippable, float LingerTime);
+
+	/** Logs pool sizes and reuse counts. */
+	void DumpStats() const;
+
+	/** AActor Interface Begin */
+	virtual void PostInitializeComponents() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void Tick(float DeltaSeconds) override;
+	/** AActor Interface End */
+
+private:
+	/** Hides an equippable and adds it to the pool for its class, or destroys it if that pool is full. */
+	void PoolEquippable(AAtomEquippable* Equippable);
+
+protected:
+	/** Max pooled equippables kept for each class. Should cover a full round of reclaimed loadouts. */
+	UPROPERTY(EditDefaultsOnly, Config, Category = EquippablePool)
+	int32 MaxPooledPerClass = 32;
+
+private:
+	/** Pooled equippables ready for reuse, keyed by class. */
+	TMap<UClass*, TArray<TWeakObjectPtr<AAtomEquippable>>> PooledEquippables;
+
+	/** Released equippables waiting for their linger time to pass. */
+	TAtomLingerList<AAtomEquippable> LingeringEquippables;
+
+	uint32 NumReused = 0; // Spawns served from the pool
+	uint32 NumSpawned = 0; // Spawns that created a new actor
+	uint32 NumDestroyed = 0; // Releases destroyed because the pool was full
+};
@@ -114,16 +114,29 @@ public:
 
 	bool CanFire() const;
 
+	/** Checks if the BlockFireVolume overlaps static geometry. Tested at most once per frame, later calls use the cached result. */
 	bool IsMuzzleInGeometry() const;
 
+	/** Gets the min seconds between shot RPCs sent by clients. Shots fired in between are held for the next batch. */
+	static float GetShotBatchInterval();
+
 	/** Loads ammo for the firearm. Usually only used by the active ammo loader for the firearm for RPC support. */
 	void LoadAmmo(UObject* LoadObject, bool bForceLocalOnly = false);
 
 	/** Discards ammo for the firearm, if supported by the active ammo loader. */
 	virtual void DiscardAmmo();
 
+	/** Chambers a round without player hands. Releases the slide lock if it is active, otherwise cycles the chambering handle. */
+	void ChamberRound();
+
 	const FFirearmStats& GetFirearmStats() const;
 
+	/**
+	* Random stream for the shot being fired. Reset from the shot seed before recoil is generated, then
+	* advanced by the shot type, so every connection generates the same values for a shot.
+	*/
+	FRandomStream& GetShotRandomStream();
+
 	/** Fires a shot based on the active shot type. */
 	void FireShot();
 
@@ -173,8 +186,11 @@ protected:
 	void OnSlideLockPressed();
 	void ReleaseSlideLock();
 
-	/** Generates active shot recoil based on an input seed. Generated recoil is directly applied to RecoilVelocity. */
-	void GenerateShotRecoil(uint8 Seed);
+	/** Resets the shot random stream for a shot seed. Must be called before generating recoil for the shot. */
+	void ResetShotRandomStream(uint8 Seed);
+
+	/** Generates active shot recoil from the shot random stream. Generated recoil is directly applied to RecoilVelocity. */
+	void GenerateShotRecoil();
 
 	void ShowHelp(EHelpIndicatorType Type, const float Lifetime);
 	void ClearHelp(EHelpIndicatorType Type);
@@ -186,6 +202,12 @@ protected:
 	*/
 	void ReloadChamber(bool bIsFired);
 
+	/** Adds a shot to be sent to the server. Shots fired faster than the batch interval are sent together. */
+	void QueueShot(const FShotData& ShotData);
+
+	/** Sends all queued shots to the server in a single batch. */
+	void FlushPendingShots();
+
 	/** Callback for cartridge eject particle system to play collision audio. */
 	UFUNCTION()
 	void OnEjectedCartridgeCollide(FName EventName, float EmitterTime, int32 ParticleTime, FVector Location, FVector Velocity, 
@@ -199,7 +221,7 @@ protected:
 
 private:
 	UFUNCTION(Server, WithValidation, Reliable)
-	void ServerFireShot(FShotData ShotData);
+	void ServerFireShotBatch(const FShotBatch& ShotBatch);
 
 	UFUNCTION(Server, WithValidation, Reliable)
 	void ServerLoadAmmo(UObject* LoadObject);
@@ -218,12 +240,16 @@ public:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual void PostInitializeComponents() override;
 	virtual bool ReplicateSubobjects(class UActorChannel *Channel, class FOutBunch *Bunch, FReplicationFlags *RepFlags) override;
+	virtual void Equip(const EHand Hand, const EEquipType EquipType = EEquipType::Normal) override;
+	virtual void Unequip(const EEquipType EquipType = EEquipType::Normal) override;
 	virtual void OnEquipped() override;
 	virtual void OnUnequipped() override;
 	virtual void BeginPlay() override;
 	virtual void Destroyed() override;
 protected:
 	virtual void SetupInputComponent(UInputComponent* InputComponent) override;
+	virtual void OnPooled() override;
+	virtual void OnUnpooled() override;
 	/** AHeroEquippable Interface End */
 
 protected:
@@ -369,6 +395,37 @@ private:
 	/** True when there is active recoil and needs to return to the original location/rotation */
 	uint32 bIsRecoilActive : 1;
 
+	/** Cached result of IsMuzzleInGeometry. Only valid during MuzzleTestFrame. */
+	mutable uint32 bIsMuzzleInGeometry : 1;
+
+	/** Frame the muzzle was last tested for geometry. */
+	mutable uint64 MuzzleTestFrame = 0;
+
+	/** Shots fired by the owning client that have not been sent to the server yet. */
+	FShotBatch PendingShots;
+
+	/** Time each pending shot was fired. Parallel to PendingShots.Shots. */
+	TArray<float, TInlineAllocator<FShotBatch::MaxShots>> PendingShotTimes;
+
+	/** Last time a shot batch was sent to the server. */
+	float LastShotBatchTime = 0.f;
+
+	/** Server only. Limits replayed client shots to the fire rate. */
+	FTokenBucket ServerShotBudget;
+
+	/** Base seed for shot random streams. Chosen by the server when the firearm is spawned. */
+	UPROPERTY(Replicated)
+	int32 ShotRandomSeed = 0;
+
+	/** 
+	 * Sequence number of the next shot. Reset on equip. The owner and server advance it for every shot the owner fires, 
+	 * and the server only replays shots with its own sequence. Simulated proxies keep their own count, so their spread
+	 * and recoil are cosmetic. Wraps around.
+	 */
+	uint8 ShotSequence = 0;
+
+	FRandomStream ShotRandomStream;
+
 	FHelpIndicatorHandle HelpHandles[static_cast<uint8>(EHelpIndicatorType::MAX_COUNT)];
 };
 
@@ -376,4 +433,6 @@ FORCEINLINE UEquippableState* AAtomFirearm::GetFiringState() const { return Firi
 
 FORCEINLINE UEquippableState* AAtomFirearm::GetChargingState() const { return ChargingState; }
 
-FORCEINLINE const FFirearmStats& AAtomFirearm::GetFirearmStats() const { return Stats; }
\ No newline at end of file
+FORCEINLINE const FFirearmStats& AAtomFirearm::GetFirearmStats() const { return Stats; }
+
+FORCEINLINE FRandomStream& AAtomFirearm::GetShotRandomStream() { return ShotRandomStream; }
\ No newline at end of file
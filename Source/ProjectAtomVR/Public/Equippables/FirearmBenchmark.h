@@ -0,0 +1,68 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#pragma once
+
+/** Firearm functions timed while a firearm benchmark is recording. */
+enum class EFirearmBenchmarkTimer : uint8
+{
+	FireShot,
+	ReloadChamber,
+	UpdateChamberingHandle,
+	UpdateRecoilOffset,
+	Max
+};
+
+/**
+ * Times the firearm fire and reload path. Recorded by the ProjectAtom.Firearms.FireAndReload automation test, which fires
+ * and reloads a firearm with each ammo loader type in a test world and writes the results as json to 
+ * Saved/Profiling/FirearmBenchmark. Runs headless, i.e. -nullrhi -ExecCmds="Automation RunTests ProjectAtom.Firearms".
+ */
+class PROJECTATOMVR_API FFirearmBenchmark
+{
+public:
+	/** Clears all samples and starts recording. */
+	static void Start();
+
+	/** 
+	* Stops recording and writes the results.
+	*
+	* @param Name Name of the recorded run, used in the results file name.
+	*/
+	static void Stop(const FString& Name);
+
+	static bool IsRecording() { return bIsRecording; }
+
+	static void AddSample(EFirearmBenchmarkTimer Timer, uint32 Cycles);
+
+	/** Number of samples recorded for a timer since recording started. */
+	static int32 GetSampleCount(EFirearmBenchmarkTimer Timer);
+
+private:
+	static void WriteResults(const FString& Name, double ElapsedTime);
+
+	static bool bIsRecording;
+};
+
+/** Times the enclosing scope while a firearm benchmark is recording. */
+struct FScopedFirearmBenchmarkTimer
+{
+	FScopedFirearmBenchmarkTimer(EFirearmBenchmarkTimer InTimer)
+		: Timer(InTimer)
+		, bIsTiming(FFirearmBenchmark::IsRecording())
+		, StartCycles(bIsTiming ? FPlatformTime::Cycles() : 0)
+	{
+	}
+
+	~FScopedFirearmBenchmarkTimer()
+	{
+		if (bIsTiming)
+		{
+			FFirearmBenchmark::AddSample(Timer, FPlatformTime::Cycles() - StartCycles);
+		}
+	}
+
+private:
+	EFirearmBenchmarkTimer Timer;
+	bool bIsTiming;
+	uint32 StartCycles;
+};
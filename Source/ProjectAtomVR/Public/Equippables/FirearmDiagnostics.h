@@ -0,0 +1,47 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#pragma once
+
+/** Firearm log category. Defaults to warnings only, use "log LogFirearm Verbose" for more. */
+DECLARE_LOG_CATEGORY_EXTERN(LogFirearm, Warning, All);
+
+/** Categories of firearm diagnostics. Each has its own log rate limit. */
+enum class EFirearmTraceCategory : uint8
+{
+	Fire,
+	Reload,
+	Recoil,
+	Network,
+	Max
+};
+
+/**
+ * Firearm diagnostics. Per shot events are traced into a fixed size in-memory ring buffer instead of the log.
+ * Records are only formatted when dumped with the s.DumpFirearmTrace console command. Log messages written
+ * through FIREARM_LOG are limited to s.FirearmLogRate messages a second for each category.
+ */
+class PROJECTATOMVR_API FFirearmDiagnostics
+{
+public:
+	enum { TraceCapacity = 1024 };
+
+	/**
+	* Records an event in the trace ring buffer, overwriting the oldest record once full.
+	*
+	* @param Event Static string naming the event. Only the pointer is stored.
+	*/
+	static void Trace(EFirearmTraceCategory Category, const AActor* Firearm, const TCHAR* Event, int32 Value0 = 0, int32 Value1 = 0);
+
+	/** Checks if a log message in a category is within its rate limit. Consumes from the limit if it is. */
+	static bool ShouldLog(EFirearmTraceCategory Category);
+
+	/** Logs the most recent trace records, oldest first. */
+	static void DumpTrace(int32 MaxRecords = TraceCapacity);
+
+	/** Clears all trace records. */
+	static void ClearTrace();
+};
+
+/** Logs to LogFirearm if the verbosity is enabled and the category is within its rate limit. */
+#define FIREARM_LOG(Category, Verbosity, Format, ...) \
+	UE_CLOG(FFirearmDiagnostics::ShouldLog(EFirearmTraceCategory::Category), LogFirearm, Verbosity, Format, ##__VA_ARGS__)
@@ -17,6 +17,11 @@ public:
 
 	USphereComponent* GetLoadTrigger() const;
 
+protected:
+	/** AAtomEquippable Interface Begin */
+	virtual void OnUnpooled() override;
+	/** AAtomEquippable Interface End */
+
 protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Magazine)
 	USphereComponent* LoadTrigger;
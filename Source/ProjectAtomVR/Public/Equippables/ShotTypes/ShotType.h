@@ -18,13 +18,43 @@ struct FShotData
 	UPROPERTY()
 	FVector_NetQuantize10 Start;
 
-	// The end location of the shot
+	// The aim direction of the shot. Spread is applied by the shot type from Seed.
 	UPROPERTY()
-	FVector_NetQuantize10 End;
+	FVector_NetQuantizeNormal Direction;
 
-	// Seed used to generate any random data for the shot
+	// Shot sequence number of the firing firearm. The server checks it against its own sequence and never uses it to seed spread.
 	UPROPERTY()
-	uint8 Seed;
+	uint8 Seed = 0;
+
+	// Seconds the shot was held in a client batch before being sent. Added to the lag compensation rewind.
+	float BatchDelay = 0.f;
+};
+
+//-------------------------------------------------------------------------------------
+// Shots fired by a client within one net update, sent to the server as a single RPC.
+// The first shot is sent in full and the rest are sent relative to it. Seeds in a batch
+// are consecutive, so only the first is sent.
+//-------------------------------------------------------------------------------------
+USTRUCT()
+struct FShotBatch
+{
+	GENERATED_USTRUCT_BODY()
+
+	enum { MaxShots = 8 };
+
+	// Shots in the order they were fired
+	TArray<FShotData, TInlineAllocator<MaxShots>> Shots;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FShotBatch> : public TStructOpsTypeTraitsBase
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
 };
 
 /**
@@ -30,6 +30,12 @@ protected:
 	*/
 	FHitResult WeaponTrace(const FVector& Start, const FVector& End) const;
 
+	/**
+	* Gets the trace end of each shot fired, applying spread from a random stream. The stream is advanced
+	* the same way on every connection, so the server and clients generate the same ends for a shot.
+	*/
+	void GetShotEnds(const FShotData& ShotData, FRandomStream& RandomStream, TArray<FVector, TInlineAllocator<8>>& OutEnds) const;
+
 	/** UShotType interface */
 public:
 	virtual FShotData GetShotData() const override;
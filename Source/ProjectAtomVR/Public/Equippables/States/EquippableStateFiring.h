@@ -13,6 +13,21 @@ class PROJECTATOMVR_API UEquippableStateFiring : public UEquippableState
 {
 	GENERATED_BODY()
 
+public:
+	/** True if shots are fired until the trigger is released rather than in bursts. */
+	bool IsFullyAutomatic() const { return BurstCount == 0; }
+
+	/** Number of shots fired since entering the state. */
+	int32 GetShotsFired() const { return ShotsFired; }
+
+	float GetLastShotTimestamp() const { return LastShotTimestamp; }
+
+	/** Overrides the configured BurstCount. Fully automatic if 0. */
+	void SetBurstCount(int32 InBurstCount) { BurstCount = InBurstCount; }
+
+	/** Restores shot counters and BurstCount, which simulated proxies override for each update. */
+	void ResetFiring();
+
 protected:
 	/**
 	* Handler for trigger released input.	
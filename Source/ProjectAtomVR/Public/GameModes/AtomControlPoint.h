@@ -48,6 +48,18 @@ public:
 	/** Gets the members of the controlling team that are within the capture bounds. */
 	TArray<AAtomPlayerState*> GetActiveControllingTeamMembers() const;
 
+	/** Gets the number of living members of a team within the capture bounds. Only maintained on server. */
+	int32 GetTeamPresence(int32 TeamId) const;
+
+	/** Gets the number of living characters of all teams within the capture bounds. Only maintained on server. */
+	int32 GetTotalPresence() const;
+
+	/** True if a living character is within the capture bounds. Only maintained on server. */
+	bool IsCharacterPresent(const AAtomCharacter* Character) const;
+
+	/** Removes a character from the point, i.e. when killed. Leaving the capture bounds is handled automatically. */
+	void RemovePresence(const AAtomCharacter* Character);
+
 	/** AAtomGameObjective Interface Begin */
 	virtual void InitializeObjective() override;
 	/** AAtomGameObjective Interface End */
@@ -96,6 +108,12 @@ protected:
 
 	void UpdateControlState();
 
+	/** Counts a character for its current team if it is alive and not already present. */
+	void AddPresence(AAtomCharacter* Character);
+
+	/** Clears all presence counts. */
+	void ResetPresence();
+
 	void SetControlState(const EControlState State);
 
 	void BroadcastTeamMessage(AAtomTeamInfo* Team, const UAtomObjectiveMessage::EType Type);
@@ -121,7 +139,13 @@ protected:
 	int32 MaxTeamInfluence = 3; // Max team members that can influence the capture rate.
 
 	// Indexed by team id, the number of players inside the bounds of the point. Only maintained on server.
-	TArray<TArray<AAtomCharacter*>> TeamOverlaps;
+	TArray<int32> TeamPresence;
+
+	// Team id each present character was counted for. Characters are removed from the team they entered with,
+	// so team changes and deaths that clear the player state keep the counts balanced.
+	TMap<const AAtomCharacter*, int32> PresentCharacters;
+
+	int32 NumTeamsPresent = 0; // Number of teams with at least one member present
 
 	FOnCaptured OnCapturedEvent;
 
@@ -155,3 +179,9 @@ private:
 FORCEINLINE UBoxComponent* AAtomControlPoint::GetCaptureBounds() const { return CaptureBounds; }
 
 FORCEINLINE UStaticMeshComponent* AAtomControlPoint::GetOutlineMesh() const { return OutlineMesh; }
+
+FORCEINLINE int32 AAtomControlPoint::GetTeamPresence(int32 TeamId) const { return TeamPresence.IsValidIndex(TeamId) ? TeamPresence[TeamId] : 0; }
+
+FORCEINLINE int32 AAtomControlPoint::GetTotalPresence() const { return PresentCharacters.Num(); }
+
+FORCEINLINE bool AAtomControlPoint::IsCharacterPresent(const AAtomCharacter* Character) const { return PresentCharacters.Contains(Character); }
@@ -45,8 +45,17 @@ protected:
 	UFUNCTION(BlueprintNativeEvent, Category = AtomGameMode)
 	void ScoreDeath(AAtomPlayerState* Killer, AAtomPlayerState* Victim);
 
-	/** Checks if a playerstart is valid for a specified player. */
-	virtual bool IsValidPlayerStart(AController* Player, APlayerStart* PlayerStart);
+	/** 
+	 * Gets the team id of the player starts a player may spawn at. Players with different spawn teams are treated as 
+	 * enemies when scoring starts. INDEX_NONE allows any start and treats all other players as enemies.
+	 */
+	virtual int32 GetPlayerStartTeam(AController* Player) const;
+
+	/**
+	 * Caches all player starts in the world, bucketed by team id. Called on InitGame and when a level is added to or
+	 * removed from the world, i.e. streamed. Reservations of starts that are still in the world are kept.
+	 */
+	void CachePlayerStarts();
 
 	/** Applies playlist settings to the gamemode. Called if the gamemode is loaded with the bUsePlaylist url flag. */
 	virtual void ApplyPlaylistSettings(const struct FPlaylistItem& Playlist);
@@ -67,6 +76,18 @@ protected:
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = AtomGameMode)
 	void CheckForGameWinner(AAtomPlayerState* Scorer);	
 
+	/** 
+	 * Starts the timer for the current match state phase and replicates its end time. Durations <= 0 have no time 
+	 * limit. 
+	 */
+	void StartPhaseTimer(float Duration);
+
+	/** Called when the current match state phase timer expires. */
+	virtual void OnPhaseTimerExpired();
+
+	/** Called each whole second remaining in a timed phase. Sends countdown messages. */
+	virtual void OnPhaseSecondElapsed();
+
 	/** Called when the match transitions to Countdown. */
 	virtual void HandleMatchEnteredCountdown();
 
@@ -88,9 +109,15 @@ protected:
 	/** Called when the match transitions to LeavingIntermission. */
 	virtual void HandleMatchLeavingIntermission();	
 
+	/** 
+	 * Resets a player's existing character in place for the next round. 
+	 *
+	 * @returns False if the player has no character to reuse and needs to be restarted.
+	 */
+	virtual bool ResetPlayerForRound(AController* Controller);
+
 	/** AAtomBaseGameMode Interface Begin */
 protected:
-	virtual void CheckGameTime() override;
 	virtual bool IsCharacterChangeAllowed_Implementation(class AAtomPlayerController* Controller) const override;
 	/** AAtomBaseGameMode Interface End */
 
@@ -116,6 +143,11 @@ protected:
 	virtual AActor* ChoosePlayerStart_Implementation(AController* Player) override;
 	/** AGameModeBase Interface End */
 
+	/** AActor Interface Begin */
+public:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	/** AActor Interface End */
+
 protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Messages)
 	TSubclassOf<class UAtomDeathLocalMessage> DeathMessageClass;
@@ -154,9 +186,38 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = AtomGameMode)
 	int32 CountdownTime = 5; // Seconds for Countdown match state
-	
-	int32 Countdown = 0; // Used to maintain active countdowns
+
+	/** Seconds a chosen player start is reserved for the player spawning at it. */
+	UPROPERTY(EditDefaultsOnly, Config, Category = Spawning)
+	float SpawnReservationTime = 2.f;
+
+	/** A start is occupied while any other pawn, including teammates, is within this distance of it. */
+	UPROPERTY(EditDefaultsOnly, Config, Category = Spawning)
+	float SpawnOccupiedRadius = 100.f;
 
 	uint32 bFirstRoundInitialized : 1;
 	uint32 bMinuteWarningSent : 1;
+	uint32 bRoundTimeExpired : 1;
+
+private:
+	/** Recaches player starts when a level of this world is added or removed. */
+	void OnLevelChanged(ULevel* Level, UWorld* World);
+
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+
+	struct FCachedPlayerStart
+	{
+		TWeakObjectPtr<APlayerStart> PlayerStart;
+		TWeakObjectPtr<AController> ReservedBy; // Last player to spawn at the start
+		float ReservedUntil = 0.f;
+	};
+
+	TArray<FCachedPlayerStart> CachedPlayerStarts;
+	TMap<int32, TArray<int32>> PlayerStartsByTeam; // Indices into CachedPlayerStarts. INDEX_NONE holds every start.
+	TArray<FVector> PawnLocations; // Other pawns, reused each ChoosePlayerStart
+	TArray<FVector> EnemyLocations; // Enemy pawns, reused each ChoosePlayerStart
+
+	FTimerHandle TimerHandle_Phase;
+	FTimerHandle TimerHandle_PhaseSecond;
 };
@@ -23,6 +23,16 @@ public:
 	void SetGameWinner(AAtomPlayerState* Winner);
 	AAtomPlayerState* GetGameWinner() const;
 
+	/** 
+	 * Sets the time the current match state phase ends. Only the end time is replicated, remotes derive the 
+	 * remaining time from the server world time. Durations <= 0 have no time limit. 
+	 */
+	void SetPhaseDuration(float Duration);
+
+	/** Gets the seconds remaining in the current match state phase. 0 if the phase has no time limit. */
+	UFUNCTION(BlueprintCallable, Category = AtomGameState)
+	float GetRemainingTime() const;
+
 	/** AGameState Interface Begin */
 	virtual void DefaultTimer() override;
 	/** AGameState Interface End */
@@ -53,6 +63,10 @@ public:
 	UPROPERTY(Replicated, Transient, BlueprintReadOnly, Category = AtomGameMode)
 	int32 CurrentRound = 0;
 
-	UPROPERTY(Replicated, Transient, BlueprintReadOnly, Category = AtomGameMode)
-	int32 RemainingTime; // Timer for the current MatchState (game timer, intermission timer, countdown timer, etc.)
+	UPROPERTY(Transient, BlueprintReadOnly, Category = AtomGameMode)
+	int32 RemainingTime; // Whole seconds left in the current MatchState, updated locally by DefaultTimer. See GetRemainingTime.
+
+private:
+	UPROPERTY(Replicated, Transient)
+	float PhaseEndTime = 0.f; // Server world time the current MatchState phase ends. 0 = No time limit.
 };
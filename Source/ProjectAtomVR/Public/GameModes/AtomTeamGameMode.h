@@ -36,6 +36,15 @@ protected:
 	*/
 	void MovePlayerToTeam(AController* Controller, AAtomPlayerState* PlayerState, class AAtomTeamInfo* Team);		
 
+	/**
+	* Mutes or unmutes a player and all other players on a team for each other. Pairs where either player has no valid
+	* UniqueId are skipped, and the player without one is queued to be updated again once it is valid.
+	*/
+	void SetTeamGameplayMuted(APlayerController* aPlayer, class AAtomTeamInfo* Team, bool bMuted);
+
+	/** Redoes the full mute list update of queued players whose UniqueId has become valid. */
+	void UpdatePendingMuteLists();
+
 	/** AtomGameMode Interface Begin */
 public:
 	virtual bool CanDamage_Implementation(AController* Instigator, AController* Reciever) const;
@@ -46,13 +55,14 @@ protected:
 	virtual void HandleMatchLeavingIntermission() override;
 	virtual void EndRound() override;
 	virtual void ApplyPlaylistSettings(const FPlaylistItem& Playlist) override;
-	virtual bool IsValidPlayerStart(AController* Player, APlayerStart* PlayerStart) override;
+	virtual int32 GetPlayerStartTeam(AController* Player) const override;
 	virtual void CheckForGameWinner_Implementation(AAtomPlayerState* Scorer) override;
 	/** AtomGameMode Interface End */
 
 	/** AGameMode Interface Begin */
 public:
 	virtual void InitSeamlessTravelPlayer(AController* NewController) override;
+	virtual void Tick(float DeltaSeconds) override;
 	/** AGameMode Interface End */
 
 	/** AGameModeBase Interface Begin */
@@ -75,4 +85,10 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = TeamGameMode)
 	uint32 bMuteTeams : 1; /** If opposing teams should be muted */
+
+private:
+	TMap<TWeakObjectPtr<APlayerController>, int32> MuteListTeams; // Team each player's mute list was last updated for
+
+	/** Players skipped by a mute list update because their UniqueId was not valid yet. */
+	TArray<TWeakObjectPtr<APlayerController>> PendingMuteListPlayers;
 };
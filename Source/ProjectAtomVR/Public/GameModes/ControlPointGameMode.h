@@ -27,6 +27,7 @@ public:
 	/** AtomGameMode Interface Begin */
 protected:	
 	virtual void ScoreKill_Implementation(AAtomPlayerState* Killer, AAtomPlayerState* Victim) override;
+	virtual void ScoreDeath_Implementation(AAtomPlayerState* Killer, AAtomPlayerState* Victim) override;
 	virtual void OnObjectiveInitialized(class AAtomGameObjective* Objective) override;
 	virtual void InitGameStateForRound(AAtomGameState* GameState) override;
 	virtual void HandleMatchHasStarted() override;
@@ -35,10 +36,10 @@ protected:
 	virtual void HandleMatchLeavingIntermission() override;
 	/** AtomGameMode Interface End */
 
-	/** AAtomBaseGameMode Interface Begin */
-protected:
-	virtual void DefaultTimer() override;
-	/** AAtomBaseGameMode Interface End */
+	/** AActor Interface Begin */
+public:
+	virtual void Tick(float DeltaSeconds) override;
+	/** AActor Interface End */
 
 protected:
 	UPROPERTY(EditDefaultsOnly, Category = ControlPoint)
@@ -60,4 +61,8 @@ protected:
 	TArray<class AAtomControlPoint*> GameControlPoints; // Ordered control points for each round	
 
 	FDelegateHandle ControlPointCapturedHandle;
+
+private:
+	TWeakObjectPtr<class AAtomTeamInfo> AccruingTeam; // Team accruing control score
+	float AccruedControlScore = 0.f; // Control score accrued by AccruingTeam not yet added to the team score
 };
@@ -35,10 +35,24 @@ private:
 	/**
 	* Updates the collision offset based on the current camera location.
 	* This component will be moved in the event that collisions take place as a result
-	* of the new collision offset.
+	* of the new collision offset. Does nothing if the head has not moved past the
+	* collision offset tolerance or capsule height error.
 	*/
 	void UpdateCollisionOffset();
 
+protected:
+	/** Distance, in cm, the head must move horizontally before the collision offset is swept and the body rebuilt. */
+	UPROPERTY(EditDefaultsOnly, Category = HMDCapsule)
+	float CollisionOffsetTolerance = 0.1f;
+
+	/** Max difference between HMD height and capsule height allowed before the capsule is resized. */
+	UPROPERTY(EditDefaultsOnly, Category = HMDCapsule)
+	float MaxCapsuleHeightError = 5.f;
+
+	/** Height padding applied to capsule in addition to HMD height */
+	UPROPERTY(EditDefaultsOnly, Category = HMDCapsule)
+	float CapsuleHeightPadding = 25.f;
+
 private:
 	class UHMDCameraComponent* Camera = nullptr;
 
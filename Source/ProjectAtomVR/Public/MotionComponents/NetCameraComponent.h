@@ -3,10 +3,13 @@
 #pragma once
 
 #include "Camera/CameraComponent.h"
+#include "NetTransformBuffer.h"
 #include "NetCameraComponent.generated.h"
 
 /**
- * Camera Component that supports movement replication.
+ * Camera Component that supports movement replication. Transforms from the owning client are
+ * received through UNetMotionPoseComponent. Simulated proxies play received transforms back
+ * through an interpolation buffer.
  */
 UCLASS()
 class PROJECTATOMVR_API UNetCameraComponent : public UCameraComponent
@@ -16,6 +19,22 @@ class PROJECTATOMVR_API UNetCameraComponent : public UCameraComponent
 public:
 	UNetCameraComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+	/**
+	* Applies a relative transform received from the owning client. Transforms within the dead-band of the
+	* current transform are dropped, so they are not replicated and do not notify OnPostNetTransformUpdate.
+	*
+	* @param TimeStamp	Server world time the owning client captured the transform at.
+	* @param bForceUpdate Notify OnPostNetTransformUpdate even if the transform was dropped, i.e. the hands moved.
+	* @returns True if the transform was applied.
+	*/
+	bool SetNetTransform(const FVector& Location, const FRotator& Rotation, float TimeStamp, bool bForceUpdate = false);
+
+	/** If replicated transforms are being played back through the interpolation buffer. */
+	bool IsInterpolatingNetTransform() const;
+
+	/** Gets the seconds that simulated proxies delay received transforms. */
+	float GetInterpolationDelay() const { return InterpolationDelay; }
+
 	/** USceneComponent Interface Begin */
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	/** USceneComponent Interface End */
@@ -28,22 +47,44 @@ protected:
 	virtual void PreNetReceive() override;
 	/** UActorComponent Interface End */
 
-private:
-	UFUNCTION(Server, WithValidation, Reliable)
-	void ServerSendTransform(const FVector_NetQuantize10 Location, const FRotator Rotation);
-
 public:
 	/** 
-	 * Delegate called after a transform update has been received from the network. 
+	 * Delegate called after a transform update has been received from the network. Not called
+	 * for interpolated transforms.
 	 * @param DeltaTime The time since the last net update was received.
 	 */
 	DECLARE_DELEGATE_OneParam(FPostNetTransformUpdate, float /*DeltaTime*/)
 	FPostNetTransformUpdate OnPostNetTransformUpdate;
 
 protected:
-	/** Times per second transform updates are sent to the server */
+	/** Seconds that simulated proxies delay received transforms. Set to 0 to apply transforms as they arrive. */
+	UPROPERTY(EditDefaultsOnly, Category = NetCamera)
+	float InterpolationDelay = 0.1f;
+
+	/** Max seconds that simulated proxies extrapolate past the newest received transform. */
+	UPROPERTY(EditDefaultsOnly, Category = NetCamera)
+	float MaxExtrapolationTime = 0.1f;
+
+	/** Location change, in cm, below which a net transform is treated as unchanged. */
+	UPROPERTY(EditDefaultsOnly, Category = NetCamera)
+	float NetLocationDeadBand = 0.05f;
+
+	/** Rotation change, in degrees, below which a net transform is treated as unchanged. */
 	UPROPERTY(EditDefaultsOnly, Category = NetCamera)
-	float NetUpdateFrequency = 50.f;
+	float NetRotationDeadBand = 0.1f;
 
 	float LastNetUpdate = 0.f;
+
+private:
+	/** If the owner is a pawn controlled on this machine. */
+	bool IsLocallyControlledOwner() const;
+
+	/** Server world time the replicated transform was captured at. Simulated proxies buffer transforms on this timeline. */
+	UPROPERTY(Replicated)
+	float NetTimeStamp = 0.f;
+
+	FNetTransformBuffer NetTransformBuffer;
+
+	FVector SavedLocation = FVector::ZeroVector; // Relative location before the last net receive
+	FRotator SavedRotation = FRotator::ZeroRotator; // Relative rotation before the last net receive
 };
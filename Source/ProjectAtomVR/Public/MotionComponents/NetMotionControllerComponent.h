@@ -3,10 +3,13 @@
 #pragma once
 
 #include "MotionControllerComponent.h"
+#include "NetTransformBuffer.h"
 #include "NetMotionControllerComponent.generated.h"
 
 /**
- * Motion Controller Component that supports movement replication.
+ * Motion Controller Component that supports movement replication. Transforms from the owning client are
+ * received through UNetMotionPoseComponent. Simulated proxies play received transforms back through an 
+ * interpolation buffer.
  */
 UCLASS(meta = (BlueprintSpawnableComponent))
 class PROJECTATOMVR_API UNetMotionControllerComponent : public UMotionControllerComponent
@@ -14,6 +17,21 @@ class PROJECTATOMVR_API UNetMotionControllerComponent : public UMotionController
 	GENERATED_BODY()
 	
 public:
+	/**
+	* Applies a relative transform received from the owning client. Transforms within the dead-band of the
+	* current transform are dropped so they are not replicated.
+	*
+	* @param TimeStamp	Server world time the owning client captured the transform at.
+	* @returns True if the transform was applied.
+	*/
+	bool SetNetTransform(const FVector& Location, const FRotator& Rotation, float TimeStamp);
+
+	/** If replicated transforms are being played back through the interpolation buffer. */
+	bool IsInterpolatingNetTransform() const;
+
+	/** Gets the seconds that simulated proxies delay received transforms. */
+	float GetInterpolationDelay() const { return InterpolationDelay; }
+
 	/** UMotionControllerComponent Interface Begin */
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 	/** UMotionControllerComponent Interface End */
@@ -22,14 +40,39 @@ public:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	/** USceneComponent Interface End */
 
-private:
-	UFUNCTION(Server, WithValidation, Reliable)
-	void ServerSendTransform(const FVector_NetQuantize10 Location, const FRotator Rotation);
+	/** UActorComponent Interface Begin */
+protected:
+	virtual void PostNetReceive() override;
+	virtual void PreNetReceive() override;
+	/** UActorComponent Interface End */
 
 protected:
-	/** Times per second transform updates are sent to the server */
+	/** Seconds that simulated proxies delay received transforms. Set to 0 to apply transforms as they arrive. */
+	UPROPERTY(EditDefaultsOnly, Category = NetMotionController)
+	float InterpolationDelay = 0.1f;
+
+	/** Max seconds that simulated proxies extrapolate past the newest received transform. */
 	UPROPERTY(EditDefaultsOnly, Category = NetMotionController)
-	float NetUpdateFrequency = 30.f;
+	float MaxExtrapolationTime = 0.1f;
+
+	/** Location change, in cm, below which a net transform is treated as unchanged. */
+	UPROPERTY(EditDefaultsOnly, Category = NetMotionController)
+	float NetLocationDeadBand = 0.05f;
+
+	/** Rotation change, in degrees, below which a net transform is treated as unchanged. */
+	UPROPERTY(EditDefaultsOnly, Category = NetMotionController)
+	float NetRotationDeadBand = 0.1f;
+
+private:
+	/** If the owner is a pawn controlled on this machine. */
+	bool IsLocallyControlledOwner() const;
+
+	/** Server world time the replicated transform was captured at. Simulated proxies buffer transforms on this timeline. */
+	UPROPERTY(Replicated)
+	float NetTimeStamp = 0.f;
+
+	FNetTransformBuffer NetTransformBuffer;
 
-	float LastNetUpdate = 0.f;
+	FVector SavedLocation = FVector::ZeroVector; // Relative location before the last net receive
+	FRotator SavedRotation = FRotator::ZeroRotator; // Relative rotation before the last net receive
 };
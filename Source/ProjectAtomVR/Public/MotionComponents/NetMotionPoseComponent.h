@@ -0,0 +1,68 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "NetMotionPoseComponent.generated.h"
+
+/**
+ * Streams the head and hand transforms of the owning character from the controlling client to the server.
+ * All tracked devices are folded into a single unreliable, sequence numbered pose so packet loss never
+ * stalls the reliable buffer.
+ */
+UCLASS()
+class PROJECTATOMVR_API UNetMotionPoseComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UNetMotionPoseComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	/** UActorComponent Interface Begin */
+	virtual void BeginPlay() override;
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
+	/** UActorComponent Interface End */
+
+private:
+	UFUNCTION(Server, WithValidation, Unreliable)
+	void ServerSendPose(FMotionPoseRep Pose);
+
+	/** Fills a pose with the current relative transforms of the tracked devices. */
+	void GatherPose(FMotionPoseRep& OutPose) const;
+
+	/** Checks if any device in a pose moved outside the dead-band since the last sent pose. */
+	bool HasPoseChanged(const FMotionPoseRep& Pose) const;
+
+protected:
+	/** Times per second poses are sent to the server */
+	UPROPERTY(EditDefaultsOnly, Category = NetMotionPose)
+	float NetUpdateFrequency = 50.f;
+
+	/** Location change, in cm, of any device required to send a new pose. */
+	UPROPERTY(EditDefaultsOnly, Category = NetMotionPose)
+	float LocationDeadBand = 0.05f;
+
+	/** Rotation change, in degrees, of any device required to send a new pose. */
+	UPROPERTY(EditDefaultsOnly, Category = NetMotionPose)
+	float RotationDeadBand = 0.1f;
+
+	/** Seconds between poses while nothing moves. Poses are unreliable, so the last one is resent in case it was lost. */
+	UPROPERTY(EditDefaultsOnly, Category = NetMotionPose)
+	float IdleResendInterval = 0.5f;
+
+	/** Max seconds a pose time stamp may lag the server world time. Older time stamps are clamped to this age. */
+	UPROPERTY(EditDefaultsOnly, Category = NetMotionPose)
+	float MaxPoseAge = 0.5f;
+
+private:
+	class AAtomCharacter* Character = nullptr; // The owning character
+
+	float LastNetUpdate = 0.f;
+
+	FMotionPoseRep LastSentPose; // Client pose last sent to the server
+
+	uint16 NextSequence = 0; // Client sequence for the next sent pose
+	uint16 LastReceivedSequence = 0; // Server sequence of the last applied pose
+	float LastReceivedTimeStamp = 0.f; // Server time stamp of the last applied pose
+	uint32 bHasReceivedPose : 1;
+};
@@ -0,0 +1,56 @@
+// Copyright 2016 Epic Wolf Productions, Inc. All Rights Reserved.
+
+#pragma once
+
+/**
+ * Time stamped ring buffer of relative transforms received from the network. Snapshots are stamped with
+ * the server world time the owning client captured them at, not their arrival time. Simulated proxies play
+ * transforms back with a fixed delay on that timeline, which hides irregular packet arrival and jitter,
+ * and extrapolate for a short time when packets stop arriving.
+ */
+struct PROJECTATOMVR_API FNetTransformBuffer
+{
+public:
+	/** Adds a transform captured at a specified server time. Timestamps are expected to be increasing. */
+	void AddSnapshot(float Timestamp, const FVector& Location, const FRotator& Rotation);
+
+	/**
+	* Samples the buffer at a specified time.
+	*
+	* @param Time				Time to sample at. Usually the current time minus a playout delay.
+	* @param MaxExtrapolation	Max time past the newest snapshot that motion will be extrapolated.
+	* @returns False if the buffer is empty.
+	*/
+	bool Sample(float Time, float MaxExtrapolation, FVector& OutLocation, FRotator& OutRotation) const;
+
+	void Reset();
+
+	/** Server world time of a world, used to stamp and sample snapshots. Falls back to the local world time without a game state. */
+	static float GetServerTime(const UWorld* World);
+
+	bool IsEmpty() const { return Num == 0; }
+
+private:
+	struct FSnapshot
+	{
+		float Timestamp = 0.f;
+		FVector Location = FVector::ZeroVector;
+		FQuat Rotation = FQuat::Identity;
+	};
+
+	const FSnapshot& GetSnapshot(int32 Age) const;
+
+private:
+	enum { Capacity = 16 };
+
+	FSnapshot Snapshots[Capacity];
+	int32 Head = 0; // Index of the next snapshot to write
+	int32 Num = 0;
+};
+
+/** Checks if two relative transforms are within a location (cm) and rotation (degrees) dead-band of each other. */
+FORCEINLINE bool IsWithinNetDeadBand(const FVector& LocationA, const FRotator& RotationA, const FVector& LocationB, const FRotator& RotationB,
+	float LocationDeadBand, float RotationDeadBand)
+{
+	return LocationA.Equals(LocationB, LocationDeadBand) && RotationA.Equals(RotationB, RotationDeadBand);
+}
@@ -12,7 +12,7 @@ class AAtomPlayerState;
 /**
  * 
  */
-UCLASS()
+UCLASS(Config=Game)
 class PROJECTATOMVR_API AAtomPlayerController : public APlayerController
 {
 	GENERATED_BODY()
@@ -62,6 +62,23 @@ public:
 
 	class AVRHUD* GetVRHUD() const;	
 
+	/**
+	* Checks a server RPC against the rate limit of its family for the player that owns Caller. RPCs that fail
+	* should be ignored by the caller. Always passes for local players and actors not owned by a player.
+	* Only for the Fire and Pose families, where a dropped RPC is superseded by the next one. Ammo and equip
+	* RPCs change state the client does not get corrected on, so they are only rejected by RejectServerRpc.
+	*/
+	static bool AllowServerRpc(const AActor* Caller, EServerRpcFamily Family, float Cost = 1.f);
+
+	/**
+	* Records a server RPC from the player that owns Caller that failed gameplay validation, i.e. a shot without
+	* ammo. The caller should ignore the RPC. Applies InvalidRpcAction.
+	*/
+	static void RejectServerRpc(const AActor* Caller, EServerRpcFamily Family, const TCHAR* Reason);
+
+	/** Logs the number of rejected server RPCs for each family. */
+	void DumpRejectedRpcs() const;
+
 protected:
 	void OnMenuButtonPressed();
 
@@ -75,6 +92,13 @@ private:
 	UFUNCTION(Exec)
 	void execChangeTeams();
 
+	/** Gets the controller of the remote player that owns an actor. Null for local players. */
+	static AAtomPlayerController* GetRemoteOwningController(const AActor* Actor);
+
+	const FRpcRateLimit& GetRpcRateLimit(EServerRpcFamily Family) const;
+
+	void OnServerRpcRejected(EServerRpcFamily Family, const TCHAR* Reason);
+
 	/** APlayerController Interface Begin */
 public:
 	virtual void SetPawn(APawn* aPawn) override;
@@ -101,6 +125,26 @@ protected:
 	/** Ignores pawn input. Stacked state storage, Use accessor function IgnorePawnInput() */
 	uint8 IgnorePawnInput = 0;
 
+	/** Rate limit for shot batches. */
+	UPROPERTY(EditDefaultsOnly, Config, Category = RpcValidation)
+	FRpcRateLimit FireRpcRateLimit;
+
+	/** Rate limit for head and hand poses. */
+	UPROPERTY(EditDefaultsOnly, Config, Category = RpcValidation)
+	FRpcRateLimit PoseRpcRateLimit;
+
+	/** What to do with players that keep sending rejected RPCs. */
+	UPROPERTY(EditDefaultsOnly, Config, Category = RpcValidation)
+	EInvalidRpcAction InvalidRpcAction = EInvalidRpcAction::Ignore;
+
+	/** Rejected RPCs within KickRejectionWindow before a player is kicked, if InvalidRpcAction is Kick. */
+	UPROPERTY(EditDefaultsOnly, Config, Category = RpcValidation)
+	int32 KickRejectionThreshold = 50;
+
+	/** Seconds that rejected RPCs are counted over for KickRejectionThreshold. */
+	UPROPERTY(EditDefaultsOnly, Config, Category = RpcValidation)
+	float KickRejectionWindow = 10.f;
+
 private:
 	UPROPERTY(BlueprintReadOnly, Category = AtomPlayerController, meta = (AllowPrivateAccess = "true"))
 	class AVRHUD* VRHUD = nullptr;
@@ -114,4 +158,15 @@ private:
 
 	UPROPERTY(Replicated, BlueprintReadOnly, Transient, Category = AtomPlayerController, meta = ( AllowPrivateAccess = "True" ))
 	TSubclassOf<AAtomCharacter> RequestedCharacter = nullptr;
+
+	/** Server only. Rate limiters for each RPC family from this player. */
+	FTokenBucket RpcBuckets[static_cast<uint8>(EServerRpcFamily::MAX_COUNT)];
+
+	/** Server only. Total rejected RPCs for each RPC family from this player. */
+	uint32 RejectedRpcCounts[static_cast<uint8>(EServerRpcFamily::MAX_COUNT)] = {};
+
+	int32 RecentRejections = 0; // Rejections since RecentRejectionsStartTime
+	float RecentRejectionsStartTime = 0.f;
+
+	uint32 bIsKickedForInvalidRpcs : 1;
 };